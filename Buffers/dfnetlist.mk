@@ -0,0 +1,25 @@
+# 
+# dfnetlist.mk : DFnetlist library
+# 
+# Description: 
+# Build settings of the DFnetlist library (libdfnetlist), shared by the tools
+# that work on dataflow netlists (buffers, lsq_sizing, resource_sharing).
+# The tools include this file and link against the library, so that the
+# netlist core is compiled only once and has the same API in all of them.
+#
+# DFNETLIST_DIR must point to the Buffers directory before the inclusion.
+# The library is built with 'make -C $(DFNETLIST_DIR) lib'.
+#
+
+DFNETLIST_SRCDIR = $(DFNETLIST_DIR)/src
+DFNETLIST_LIB = $(DFNETLIST_DIR)/bin/libdfnetlist.a
+
+# In-process MILP solver (Cbc linked as a library through its C interface), if installed
+ifeq ($(shell pkg-config --exists cbc && echo yes),yes)
+MILP_CFLAGS=-DMILP_CBC_LIB `pkg-config cbc --cflags`
+MILP_LFLAGS=`pkg-config cbc --libs`
+endif
+
+DFNETLIST_CFLAGS = `pkg-config libgvc --cflags` $(MILP_CFLAGS) -pthread -I $(DFNETLIST_SRCDIR)
+DFNETLIST_LFLAGS = $(DFNETLIST_LIB) `pkg-config libgvc --libs` $(MILP_LFLAGS) -pthread
+
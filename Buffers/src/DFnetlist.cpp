@@ -52,6 +52,9 @@ void DFnetlist_Impl::init()
     entryControl = invalidDataflowID;
     exitControl.clear();
     setMilpSolver();
+    setMilpThreads();
+    setBufferCache();
+    setWriteDelays();
 }
 
 void DFnetlist_Impl::setMilpSolver(const std::string& solver)
@@ -59,6 +62,21 @@ void DFnetlist_Impl::setMilpSolver(const std::string& solver)
     milpSolver = solver;
 }
 
+void DFnetlist_Impl::setMilpThreads(int threads)
+{
+    milpThreads = threads > 1 ? threads : 1;
+}
+
+void DFnetlist_Impl::setBufferCache(const std::string& dir)
+{
+    bufferCacheDir = dir;
+}
+
+void DFnetlist_Impl::setWriteDelays(bool write)
+{
+    writeDelays = write;
+}
+
 DFnetlist_Impl::DFnetlist_Impl()
 {
     init();
@@ -122,6 +140,7 @@ blockID DFnetlist_Impl::createBlock(BlockType type, const string& name)
     }
     name2block[gname] = idx;
     allBlocks.insert(idx);
+    invalidateCompactGraph();
 
     // Init the block
     Block& B = blocks[idx];
@@ -132,6 +151,7 @@ blockID DFnetlist_Impl::createBlock(BlockType type, const string& name)
     B.boolValue = false;
     B.nextFree = invalidDataflowID;
     B.basicBlock = invalidDataflowID;
+    B.scc_number = -1;
     B.DFSorder = -1;
     B.delay = 0;
     B.latency = 0;
@@ -140,6 +160,7 @@ blockID DFnetlist_Impl::createBlock(BlockType type, const string& name)
     B.slots = 0;
     B.transparent = true;
     B.freq = 0.0;
+    B.fifoDepth = B.fifoDepth_L = B.fifoDepth_S = 0;
 
     return idx;
 }
@@ -149,6 +170,7 @@ void DFnetlist_Impl::removeBlock(blockID id)
     assert(validBlock(id));
     Block& B = blocks[id];
 
+    noteRemovedConnection(id, id);
     while (not B.allPorts.empty()) removePort(*(B.allPorts.begin()));
 
     name2block.erase(B.name);
@@ -158,6 +180,7 @@ void DFnetlist_Impl::removeBlock(blockID id)
     B.nextFree = freeBlock;
     freeBlock = id;
     allBlocks.erase(id);
+    invalidateCompactGraph();
 }
 
 blockID DFnetlist_Impl::getBlock(const string& name) const
@@ -248,10 +271,36 @@ bool DFnetlist_Impl::isInnerChannel(channelID c) {
     return true;
 }
 
+// Jiantao, 01/06/2022: Adapt the above function for post buffer
+bool DFnetlist_Impl::isInnerChannel_postBuffer(channelID c) {
+    BlockType src_type = getBlockType(getSrcBlock(c));
+    BlockType dst_type = getBlockType(getDstBlock(c));
+    if (src_type == BRANCH && (dst_type == MUX || dst_type == MERGE || dst_type == CNTRL_MG)) return false;
+
+    bbID src_bb = getBasicBlock(getSrcBlock(c));
+    bbID dst_bb = getBasicBlock(getDstBlock(c));
+
+    if (src_bb == 0 || dst_bb == 0) return false;
+    return true;
+}
+
+bool DFnetlist_Impl::isBuffertoPhiChannel(channelID c, std::set<bbID> BBs) {
+    bbID src_bb = getBasicBlock(getSrcBlock(c));
+    bbID dst_bb = getBasicBlock(getDstBlock(c));
+
+    return BBs.count(src_bb) > 0 and BBs.count(dst_bb) > 0;
+}
+
 void DFnetlist_Impl::setBasicBlock(blockID id, bbID bb)
 {
     assert (validBlock(id));
+    if (blocks[id].basicBlock == bb) return;
     blocks[id].basicBlock = bb;
+
+    // The back edges of its channels depend on the basic block
+    for (portID p: blocks[id].allPorts) {
+        if (validChannel(ports[p].channel)) noteBackEdgeChannel(ports[p].channel);
+    }
 }
 
 bbID DFnetlist_Impl::getBasicBlock(blockID id) const
@@ -480,6 +529,32 @@ int DFnetlist_Impl::getLSQDepth(blockID id) const
     return blocks[id].fifoDepth;
 }
 
+// Jiantao 23/03/22 Load Queue depth
+void DFnetlist_Impl::setLoadQDepth(blockID id, int depth)
+{
+    assert(validBlock(id));
+    blocks[id].fifoDepth_L = depth;
+}
+
+// Jiantao 23/03/22 Store Queue depth
+void DFnetlist_Impl::setStoreQDepth(blockID id, int depth)
+{
+    assert(validBlock(id));
+    blocks[id].fifoDepth_S = depth;
+}
+
+int DFnetlist_Impl::getLoadQDepth(blockID id) const
+{
+    assert(validBlock(id));
+    return blocks[id].fifoDepth_L;
+}
+
+int DFnetlist_Impl::getStoreQDepth(blockID id) const
+{
+    assert(validBlock(id));
+    return blocks[id].fifoDepth_S;
+}
+
 void DFnetlist_Impl::setNumLoads(blockID id, std::string s)
 {
     assert(validPort(id));
@@ -693,7 +768,7 @@ portID DFnetlist_Impl::createPort(blockID block, bool isInput, const string& nam
     Port& P = ports[pid];
     P.id = pid;
     P.block = block;
-    P.short_name = localname;
+    P.short_name = internPortName(localname);
     P.full_name = fullname;
     P.isInput = isInput;
     P.width = width;
@@ -701,6 +776,7 @@ portID DFnetlist_Impl::createPort(blockID block, bool isInput, const string& nam
     P.type = type;
     P.channel = invalidDataflowID;
     allPorts.insert(pid);
+    invalidateCompactGraph();
 
     return pid;
 }
@@ -721,6 +797,7 @@ void DFnetlist_Impl::removePort(portID p)
     P.nextFree = freePort;
     freePort = p;
     allPorts.erase(p);
+    invalidateCompactGraph();
 }
 
 portID DFnetlist_Impl::getPort(blockID block, const string& name) const
@@ -735,7 +812,17 @@ portID DFnetlist_Impl::getPort(blockID block, const string& name) const
 const string& DFnetlist_Impl::getPortName(portID port, bool full) const
 {
     assert(validPort(port));
-    return full ? ports[port].full_name : ports[port].short_name;
+    return full ? ports[port].full_name : portNames[ports[port].short_name];
+}
+
+int DFnetlist_Impl::internPortName(const string& name)
+{
+    auto it = portName2index.find(name);
+    if (it != portName2index.end()) return it->second;
+    int idx = portNames.size();
+    portNames.push_back(name);
+    portName2index.emplace(name, idx);
+    return idx;
 }
 
 PortType DFnetlist_Impl::getPortType(portID port) const
@@ -895,6 +982,8 @@ channelID DFnetlist_Impl::createChannel(portID src, portID dst, int slots, bool
     allChannels.insert(id);
 
     ports[src].channel = ports[dst].channel = id;
+    invalidateCompactGraph();
+    noteAddedChannel(id);
     return id;
 }
 
@@ -902,11 +991,13 @@ void DFnetlist_Impl::removeChannel(channelID id)
 {
     assert(validChannel(id));
     Channel& C = channels[id];
+    noteRemovedConnection(ports[C.src].block, ports[C.dst].block);
     C.id = invalidDataflowID;
     C.nextFree = freeChannel;
     freeChannel = id;
     ports[C.src].channel = ports[C.dst].channel = invalidDataflowID;
     allChannels.erase(id);
+    invalidateCompactGraph();
 }
 
 portID DFnetlist_Impl::getSrcPort(channelID id) const
@@ -1000,9 +1091,18 @@ bool DFnetlist_Impl::hasBuffer(channelID id) const
     return channels[id].slots > 0;
 }
 
+// Error manager of the calling thread when its errors are redirected
+static thread_local ErrorMgr* threadError = nullptr;
+
+void DFnetlist_Impl::redirectThreadErrors(ErrorMgr* err)
+{
+    threadError = err;
+}
+
 void DFnetlist_Impl::setError(const string& err)
 {
-    error.set(err);
+    if (threadError != nullptr) threadError->set(err);
+    else error.set(err);
 }
 
 const string& DFnetlist_Impl::getError() const
@@ -1,11 +1,15 @@
 #ifndef DATAFLOW_IMPL_H
 #define DATAFLOW_IMPL_H
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <deque>
 #include <list>
 #include <map>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include "Dataflow.h"
 #include "ErrorManager.h"
 #include "FileUtil.h"
@@ -19,6 +23,8 @@
 #define ForAllOutputPorts(b,p)  for (portID p: getPorts(b, OUTPUT_PORTS))
 #define ForAllBasicBlocks(bb)   for (bbID bb = 0; bb < numBasicBlocks(); ++bb)
 
+struct Agraph_s; // Graph of graphviz (cgraph)
+
 namespace Dataflow
 {
 struct milpVarsEB; // Defined locally in DFnetlist_buffers.cpp
@@ -400,11 +406,31 @@ private:
      */
     void setDefaultProbabilities(double back_prob = 0.9);
 
+    // MILP model to extract basic block cycles. The model is created once and
+    // re-solved after updating the residual frequencies.
+    struct CycleModel {
+        Milp_Model milp;                    // The MILP model
+        int Freq;                           // Execution frequency of the cycle
+        std::vector<int> presenceBB;        // Presence of each block
+        std::vector<int> execBB;            // Execution of each block
+        std::vector<std::vector<int>> arcBB;// Arcs of the BBs
+        std::vector<int> rowResidual;       // Rows bounding the frequency of each block
+    };
+
+    /**
+     * @brief Creates the MILP model to extract basic block cycles.
+     * The big-M constants are defined by the initial residual frequencies,
+     * that are an upper bound for the frequencies of the next iterations.
+     * @param CM The model (output).
+     */
+    void createCycleModel(CycleModel& CM);
+
     /**
      * @brief Extracts one basic block cycle using the residual frequencies.
+     * @param CM The MILP model, updated with the current residual frequencies.
      * @return The basic block cycle.
      */
-    BasicBlockCycle extractBasicBlockCycle();
+    BasicBlockCycle extractBasicBlockCycle(CycleModel& CM);
 };
 
 /**
@@ -492,6 +518,10 @@ public:
 
     bool isInnerChannel(channelID c);
 
+    // Jiantao , 02/06/2022
+    bool isInnerChannel_postBuffer(channelID c);
+    bool isBuffertoPhiChannel(channelID c, std::set<bbID> BBs);
+
     bool getChannelMerge(channelID c); //Carmine 09.03.22 these two functions are used to preserve 
     void setChannelMerge(channelID c); //Carmine 09.03.22 the information for writing the dot after reduceMerges function
 
@@ -645,6 +675,34 @@ public:
 
     int getLSQDepth(blockID id) const;
 
+    // Jiantao 23/03/22 Set depth for Load & Store Queue separately
+    void setLoadQDepth(blockID id, int depth);
+
+    void setStoreQDepth(blockID id, int depth);
+
+    int getLoadQDepth(blockID id) const;
+
+    int getStoreQDepth(blockID id) const;
+
+    // Jiantao 09/06/2022, Add functions to modify the lsq params
+    bool setSPLoadQDepth(blockID id, int load_depth);
+
+    bool setSPStoreQDepth(blockID id, int store_depth);
+
+    void setLoadOffsets_Separated(blockID id);
+
+    void setStoreOffsets_Separated(blockID id);
+
+    void setLoadPorts_Separated(blockID id);
+
+    void setStorePorts_Separated(blockID id);
+
+    bool setSPLSQparams(blockID lsq_block_id, int load_depth, int store_depth);
+
+    bool changeOutDot(const std::string& LSQ_node_name, int optimal_load_depth, int optimal_store_depth);
+
+    bool needLSQFLow();
+
     void setNumLoads(blockID id, std::string name);
 
     const std::string& getNumLoads(blockID id) const;
@@ -1142,6 +1200,14 @@ public:
     bool writeDotBB(const std::string& filename = "");
     bool writeDotBB(std::ostream& of);
 
+    /**
+     * @brief Writes the dataflow netlist in the binary format (see NetlistBinary.h),
+     * with the same contents as the dot file written by writeDot.
+     * @param filename The name of the file.
+     * @return True if successful, and false otherwise.
+     */
+    bool writeBinary(const std::string& filename);
+
     /**
      * @brief Writes the basic blocks of a dataflow netlist in dot format.
      * @param filename The name of the file. In case the filename is empty,
@@ -1157,6 +1223,22 @@ public:
      */
     bool writeBasicBlockDot(std::ostream& s);
 
+    /**
+     * @brief Build storing structure for all Marked Graphs
+     */
+    // Jiantao, 06/06/2022
+    bool buildAdjMatrix(double coverage, std::string& dot_name, DFnetlist& out_netlist, int selected_case);
+
+    /**
+     * @brief lsq_sizing flow for several cases, extracting the MGs once
+     */
+    bool batchLSQSizing(double coverage, const std::string& dot_name, const std::vector<int>& cases);
+
+    /**
+     * @brief Micro-benchmark of the traversals of the lsq_sizing flow
+     */
+    bool benchmarkPathSearch(double coverage, int iterations);
+
     /**
      * @brief Adds elastic buffers to meet a certain cycle period and
      * guarantee elasticity in the system.
@@ -1212,6 +1294,27 @@ public:
      */
     void setMilpSolver(const std::string& solver="cbc");
 
+    /**
+     * @brief Sets the maximum number of MILP models of disjoint marked graphs
+     * that are built and solved concurrently.
+     * @param threads Number of worker threads (1 means sequential solving).
+     */
+    void setMilpThreads(int threads = 1);
+
+    /**
+     * @brief Sets the directory of the buffer cache, where the buffer placement
+     * of every disjoint marked graph is stored and reused by later runs.
+     * @param dir Path of the directory (empty to disable the cache).
+     */
+    void setBufferCache(const std::string& dir = "");
+
+    /**
+     * @brief Sets whether buffer placement writes the timing of the blocks
+     * (delays_output.txt and tmp_delays.txt in the working directory).
+     * @param write True to write the files.
+     */
+    void setWriteDelays(bool write = true);
+
     /**
      * @brief Removes all non-SCC blocks and channels.
      * @return The netlist with only the SCCs.
@@ -1259,6 +1362,42 @@ public:
      */
     double extractMarkedGraphsBB(double coverage);
 
+    // Jiantao 03/05/2022
+    // Same function as above for the LSQ flow (netlist with buffers)
+    void extractMGsBB_post_Buffer(double coverage);
+
+    /**
+     * @brief Simulates the extracted marked graphs (CFDFCs) at token level, cycle
+     * by cycle, taking into account the elastic buffers of the channels and the
+     * latency and initiation interval of the blocks. One token per iteration
+     * enters each marked graph through its back edges. It reports the measured
+     * II of each marked graph and the stall cycles of its channels.
+     * @param iterations Number of iterations simulated for each marked graph.
+     * @return True if successful, and false if some marked graph deadlocks.
+     */
+    bool simulateMarkedGraphs(int iterations = 1000);
+
+    /**
+     * @brief Simulates one execution of the netlist at token level, cycle by
+     * cycle, from the firing of the entry blocks to the firing of the exit
+     * block. Merges, muxes and branches follow their own firing rules, and the
+     * branches of each BB follow the frequencies of the BB graph (alternating
+     * the successors if there are no frequencies). It reports the cycles, the
+     * executions of the BBs and the stall cycles of the channels.
+     * @param maxCycles Max number of simulated cycles.
+     * @return True if successful, and false if the exit is not reached.
+     */
+    bool simulateNetlist(long long maxCycles = 100000000);
+
+    /**
+     * @brief Returns the throughput achieved by each CFDFC (sub marked graph) in the
+     * last buffer placement with throughput maximization (addElasticBuffersBB_sc).
+     * @return A map from the CFDFC index to its throughput (empty if not computed).
+     */
+    const std::map<int, double>& getMGThroughputs() const {
+        return MGthroughput;
+    }
+
     void printBlockSCCs();
     void computeSCCpublic(bool onlyMarked) {
         computeSCC(onlyMarked);
@@ -1313,6 +1452,8 @@ private:
         std::string memName;        // LSQ/MC name
         std::string funcName;       // Lana: name of called function (for call instruction)
         int fifoDepth;              // Lana: LSQ depth
+        int fifoDepth_L;            // Jiantao: Load Queue depth
+        int fifoDepth_S;            // Jiantao: Store Queue depth
         // Lana: LSQ json configuration info
         std::string numLoads;       
         std::string numStores;
@@ -1326,7 +1467,7 @@ private:
 
     struct Port {
         portID id;              // Identifier of the port
-        std::string short_name; // Name of the port
+        int short_name;         // Name of the port (index in portNames)
         std::string full_name;  // Full name of the port (block:port)
         blockID block;          // Owner of the port
         portID nextFree;        // Next free slot in the vector of ports
@@ -1353,6 +1494,337 @@ private:
         bool channelMerge = false;  // boolean to set the presence of merge after channel during reduceMerges function // Carmine 09.03.22
     };
 
+    // Set of blocks of a graphAdjrecord, indexed by their local number
+    struct blockBitset {
+        std::vector<uint64_t> words;
+
+        // Empty set for n blocks
+        void reset(int n) {
+            words.assign((n + 63) / 64, 0);
+        }
+
+        bool test(int i) const {
+            return (words[i >> 6] >> (i & 63)) & 1;
+        }
+
+        void set(int i) {
+            words[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    };
+
+    // Sturcture to facilitate DFS path finding processes
+    // Used for reconstructing the extracted Marked Graphs
+    // The blocks of the MG are numbered densely (local numbers, in ascending order
+    // of blockID) and the adjacency lists are stored in CSR form: the successors of
+    // block i are succ[succ_start[i]] ... succ[succ_start[i+1] - 1], in ascending order.
+    // 29/04/2022 Jiantao
+    struct graphAdjrecord {
+        // One channel of the MG
+        struct adjEdge {
+            channelID channel;
+            blockID src;
+            blockID dst;
+            bool back;  // Back edge of the netlist
+        };
+
+        // Variable definition
+        std::vector<blockID> blocks;        // Blocks of the MG (local number -> blockID)
+        std::vector<int> local;             // Local number of each blockID (-1 if not in the MG)
+        std::vector<int> succ_start;        // Successors (CSR)
+        std::vector<int> succ;
+        std::vector<char> succ_back;        // Whether some channel to the successor is a back edge
+        std::vector<int> pred_start;        // Predecessors (CSR)
+        std::vector<int> pred;
+        std::vector<int> in_start;          // Input channels (CSR), in ascending order
+        std::vector<channelID> in_channel;
+
+        // Constructor
+        graphAdjrecord() {}
+
+        // Reset graphAdjrecord
+        void clear() {
+            blocks.clear();
+            local.clear();
+            succ_start.clear();
+            succ.clear();
+            succ_back.clear();
+            pred_start.clear();
+            pred.clear();
+            in_start.clear();
+            in_channel.clear();
+        }
+
+        // Builds the adjacency lists from the channels of the MG
+        void build(const std::vector<adjEdge>& edges) {
+            clear();
+            for (const adjEdge& e: edges) {
+                blocks.push_back(e.src);
+                blocks.push_back(e.dst);
+            }
+            std::sort(blocks.begin(), blocks.end());
+            blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+            local.assign(blocks.empty() ? 0 : blocks.back() + 1, -1);
+            for (int i = 0; i < blocks.size(); i++) local[blocks[i]] = i;
+
+            // (src, dst, back) and (dst, channel), sorted to fill the CSR arrays
+            std::vector<std::tuple<int, int, bool>> out;
+            std::vector<std::pair<int, channelID>> in;
+            for (const adjEdge& e: edges) {
+                out.emplace_back(local[e.src], local[e.dst], not e.back);
+                in.emplace_back(local[e.dst], e.channel);
+            }
+            std::sort(out.begin(), out.end());
+            std::sort(in.begin(), in.end());
+
+            int n = blocks.size();
+            succ_start.assign(n + 1, 0);
+            pred_start.assign(n + 1, 0);
+            in_start.assign(n + 1, 0);
+            std::vector<std::pair<int, int>> rev;
+            for (int k = 0; k < out.size(); k++) {
+                int src = std::get<0>(out[k]), dst = std::get<1>(out[k]);
+                // Among parallel channels, a back edge comes first (back is stored negated)
+                if (k > 0 and std::get<0>(out[k-1]) == src and std::get<1>(out[k-1]) == dst) continue;
+                succ.push_back(dst);
+                succ_back.push_back(not std::get<2>(out[k]));
+                succ_start[src + 1]++;
+                rev.emplace_back(dst, src);
+            }
+            std::sort(rev.begin(), rev.end());
+            for (const auto& r: rev) {
+                pred.push_back(r.second);
+                pred_start[r.first + 1]++;
+            }
+            for (const auto& c: in) {
+                in_channel.push_back(c.second);
+                in_start[c.first + 1]++;
+            }
+            for (int i = 0; i < n; i++) {
+                succ_start[i + 1] += succ_start[i];
+                pred_start[i + 1] += pred_start[i];
+                in_start[i + 1] += in_start[i];
+            }
+        }
+
+        // Is the whole adjacent table empty?
+        bool empty() const {
+            return blocks.empty();
+        }
+
+        // Number of blocks of the corresponding MG
+        int numBlock() const {
+            return blocks.size();
+        }
+
+        // Check whether the specified block is in the MG
+        bool hasKey(blockID wanted_key) const {
+            return wanted_key >= 0 and wanted_key < local.size() and local[wanted_key] >= 0;
+        }
+
+        // Local number of a block (-1 if not in the MG)
+        int getIndex(blockID sel_block) const {
+            return hasKey(sel_block) ? local[sel_block] : -1;
+        }
+
+        // Check whether a block is adjacent to a specific block
+        bool hasBlock(blockID src_block, blockID test_block) const {
+            if (not hasKey(src_block) or not hasKey(test_block)) return false;
+            int i = local[src_block];
+            return std::binary_search(succ.begin() + succ_start[i], succ.begin() + succ_start[i + 1], local[test_block]);
+        }
+    };
+
+    // Structure to store the start point of different BBs
+    // TODO: Add Error collection part to all those structures
+    struct BB_info {
+        // Variable Definition
+        // The key shall be the bbID of each BB in the corresponding MG
+        std::map<int, int> BasicBlock_info;
+
+        // Constructor
+        BB_info() {}
+
+        // Reset
+        void clear() {
+            BasicBlock_info.clear();
+        }
+
+        // Return number of BBs in the MG
+        int numBBs() {
+            return BasicBlock_info.size();
+        }
+
+        // Check whether a specific element is in it
+        bool hasBB(int BB_index) {
+            return BasicBlock_info.count(BB_index) > 0;
+        }
+
+        // Return the start point(PhiC node) of the specified BB
+        int get_an_element(int BB_index) {
+            return BasicBlock_info[BB_index];
+        }
+
+        // Insert a start point
+        void insert_an_element(int BB_index, int block_index) {
+            BasicBlock_info[BB_index] = block_index;
+        }
+    };
+
+    // Structure to record latency info(cycles)
+    // Stores info for one MG
+    // Jiantao, 29/04/2022
+    struct timeInfo {
+        // Variable Definition
+        // the key shall be the start point and end point of the path
+        // TODO: Add comments
+        std::map<std::vector<int>, int> Latency_map;
+
+        // Constructor
+        timeInfo() {}
+
+        // Reset
+        void clear(){
+            Latency_map.clear();
+        }
+
+        // Copy
+        timeInfo(timeInfo const& other) :
+        Latency_map(other.Latency_map) {}
+
+        // Assignment
+        timeInfo& operator=(timeInfo other) {
+            other.swap(*this);
+            return *this;
+        }
+
+        // Swap
+        void swap(timeInfo& other) {
+            using std::swap;
+            swap(Latency_map, other.Latency_map);
+        }
+
+        // Return the number of stored traces
+        int numtraces() {
+            return Latency_map.size();
+        }
+
+        // Return a specific trace
+        int getTime(std::vector<int>& index) {
+            return Latency_map[index];
+        }
+
+        // Insert a trace
+        void inserttrace(std::vector<int>& index, int latency) {
+            Latency_map[index] = latency;
+        }
+
+        // Print all traces
+        bool print_trace(string str1) {
+            cout << endl;
+            cout << "=====================" << endl;
+            cout << "Traces for " << str1 << endl;
+            cout << "=====================" << endl;
+
+            // Print all traces in the map structure
+            for (map<std::vector<int>, int>::iterator it = Latency_map.begin(); it != Latency_map.end(); ++it) {
+                cout << "Time for Path(Start Point: " << it->first[0] << " " << it->first[1] << " ) "
+                << " is: " << it->second <<  endl;
+            }
+
+            return true;
+        }
+    };
+
+    // Structure to record paths' info for the extracted Marked Graph
+    // This will store info for all those different paths in one MG
+    // 29/04/2022 Jiantao
+    struct mgPathInfo {
+        // Variable definition
+        // index for the map is (Start_node, End_node)
+        std::map<std::vector<int>, std::vector<blockID>> direct_simple_paths; // direct_simple_paths stores the info of different
+
+        // Constructor
+        mgPathInfo() {}
+
+        // Copy
+        mgPathInfo(mgPathInfo const& other) :
+        direct_simple_paths(other.direct_simple_paths) {}
+
+        // Assignment
+        mgPathInfo& operator=(mgPathInfo other) {
+            other.swap(*this);
+            return *this;
+        }
+
+        // Empty
+        bool empty() {
+            return direct_simple_paths.empty();
+        }
+
+        // Swap
+        void swap(mgPathInfo& other) {
+            using std::swap;
+            swap(direct_simple_paths, other.direct_simple_paths);
+        }
+
+        // Reset paths
+        void clear() {
+            direct_simple_paths.clear();
+        }
+
+        // Return the number of different paths
+        int numPaths() {
+            return direct_simple_paths.size();
+        }
+
+        // Return the size of the struct
+        int size(){
+            return direct_simple_paths.size();
+        }
+
+        // Check whether a key exists or not
+        bool hasKey(std::vector<int>& path_index) {
+            return direct_simple_paths.count(path_index) > 0;
+        }
+
+        // Return a specific path
+        std::vector<blockID> getaPath(std::vector<int>& path_index) {
+            return direct_simple_paths[path_index];
+        }
+
+        // Check whether a block is in a specific path
+        bool hasBlock(std::vector<int>& path_index, blockID test_block) {
+            int flag = std::count(direct_simple_paths[path_index].begin(), direct_simple_paths[path_index].end(), test_block);
+
+            if (flag) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        // Insert a block in a specific path
+        void insertBlock(std::vector<int>& path_index, blockID passed_block) {
+            direct_simple_paths[path_index].push_back(passed_block);
+        }
+
+        // Print a specific direct_path
+        bool print_path(std::vector<int>& path_index) {
+            if (direct_simple_paths[path_index].empty()) {
+                return false;
+            } else {
+                cout << "================ Path Starts ================" << endl;
+                for (auto path_component: direct_simple_paths[path_index]) {
+                    cout << path_component << endl;
+                }
+                cout << "================= Path Ends =================" << endl;
+            }
+
+            return true;
+        }
+    };
+
     // Structure to represent a fragment of a netlist.
     // It is used for extracting SCCs and Marked Graphs.
     struct subNetlist {
@@ -1434,6 +1906,181 @@ private:
         }
     };
 
+    // Jiantao, 17/05/2022
+    // Struct used to store info about Marked Graph after the buffer adding process
+    struct subNetlistPostBuffer {
+        setBlocks blocks;       // Set of blocks in the subnetlist
+        setChannels channels;   // Set of channels in the subnetlist
+        set<bbID> BasicBlocks; // Set of BBs in the subnetlist
+        map<bbID, int> num_loads; // Usd to store number of loads in different BBs in one MG
+        map<bbID, int> num_stores; // Usd to store number of stores in different BBs in one MG
+
+        // Constructor
+        subNetlistPostBuffer() {}
+
+        // Copy
+        subNetlistPostBuffer(subNetlistPostBuffer const& other) :
+        blocks(other.blocks), channels(other.channels), BasicBlocks(other.BasicBlocks), num_loads(other.num_loads), num_stores(other.num_stores) {}
+
+        // Assignment
+        subNetlistPostBuffer& operator=(subNetlistPostBuffer other) {
+            other.swap(*this);
+            return *this;
+        }
+
+        // Swap
+        void swap(subNetlistPostBuffer& other) {
+            using std::swap;
+            swap(blocks, other.blocks);
+            swap(channels, other.channels);
+            swap(BasicBlocks, other.BasicBlocks);
+            swap(num_loads, other.num_loads);
+            swap(num_stores, other.num_stores);
+        }
+
+        // Resets the subnetlist
+        void clear() {
+            blocks.clear();
+            channels.clear();
+            BasicBlocks.clear();
+            num_loads.clear();
+            num_stores.clear();
+        }
+
+        // Is it empty?
+        bool empty() const {
+            return channels.empty() and blocks.empty() and BasicBlocks.empty();
+        }
+
+        // Number of blocks of the subnetlist
+        int numBlocks() const {
+            return blocks.size();
+        }
+
+        // Number of BBs of the subnetlist
+        int numBBs() const {
+            return BasicBlocks.size();
+        }
+
+        // Number of channels of the subnetlist
+        int numChannels() const {
+            return channels.size();
+        }
+
+        // Number of BBs has store operations
+        int numBBwithStore() const {
+            return num_stores.size();
+        }
+
+        // Number of BBs has Load operations
+        int numBBwithLoad() const {
+            return num_loads.size();
+        }
+
+        // Number of loads in the specified BB
+        int numofLoads_BB(int BB_index) {
+            return num_loads[BB_index];
+        }
+
+        // Number of stores in the specified BB
+        int numofStores_BB(int BB_index) {
+            return num_stores[BB_index];
+        }
+
+        // Number of loads in the subnetlist
+        int numofLoads_MG() {
+            int num_ops = 0;
+            for (auto &iter: num_loads) {
+                num_ops += iter.second;
+            }
+            return num_ops;
+        }
+
+        // Number of stores in the subnetlist
+        int numofStores_MG() {
+            int num_ops = 0;
+            for (auto &iter: num_stores) {
+                num_ops += iter.second;
+            }
+            return num_ops;
+        }
+
+        // Returns the set of BBs
+        const setBBs& getBasicBlocks() const {
+            return BasicBlocks;
+        }
+
+        // Returns the set of blocks (not modifiable)
+        const setBlocks& getBlocks() const {
+            return blocks;
+        }
+
+        // Returns the set of channels
+        const setChannels& getChannels() const {
+            return channels;
+        }
+
+        // Checks whether a BB is in the subnetlist
+        bool hasBasicBlock(bbID b) const {
+            return BasicBlocks.count(b) > 0;
+        }
+
+        // Check whether a BB has load operations
+        bool hasLoads(bbID b) const{
+            return num_loads.count(b) > 0;
+        }
+
+        // Check whether a BB has store operations
+        bool hasStores(bbID b) const{
+            return num_stores.count(b) > 0;
+        }
+
+        // Checks whether a block is in the subnetlist
+        bool hasBlock(blockID b) const {
+            return blocks.count(b) > 0;
+        }
+
+        // Checks whether a channel is in the subnetlist
+        bool hasChannel(channelID c) const {
+            return channels.count(c) > 0;
+        }
+
+        // Insert num of loads to the given BB
+        void insertNumLoad(bbID BB_index, int num_load) {
+            num_loads[BB_index] = num_load;
+        }
+
+        // Delete an element in the channel set
+        void del_channel(channelID sel_channel) {
+            channels.erase(sel_channel);
+        }
+
+        // Insert num of stores to the given BB
+        void insertNumStore(bbID BB_index, int num_store) {
+            num_stores[BB_index] = num_store;
+        }
+
+        // Inserts a BB into the subnetlist
+        void insertBasicBlock(bbID b) {
+            BasicBlocks.insert(b);
+        }
+
+        // Inserts a block into the subnetlist
+        void insertBlock(blockID b) {
+            blocks.insert(b);
+        }
+
+        // Inserts a channel into the subnetlist.
+        // The blocks connected to the channel are also inserted.
+        void insertChannel(const DFnetlist_Impl& dfn, channelID c) {
+            channels.insert(c);
+            insertBlock(dfn.getBlockFromPort(dfn.getSrcPort(c)));
+            insertBlock(dfn.getBlockFromPort(dfn.getDstPort(c)));
+            insertBasicBlock(dfn.getBasicBlock(dfn.getBlockFromPort(dfn.getDstPort(c))));
+            insertBasicBlock(dfn.getBasicBlock(dfn.getBlockFromPort(dfn.getSrcPort(c))));
+        }
+    };
+
     struct subNetlistBB {
         set <bbID> BasicBlocks;
         set <bbArcID> BasicBlockArcs;
@@ -1598,10 +2245,52 @@ private:
     bbID entryBB;               // Entry basic block
 
     std::string milpSolver;     // Name of the MILP solver
+    int milpThreads;            // Max number of MILP models solved concurrently
+    std::string bufferCacheDir; // Directory of the buffer cache (empty if disabled)
+    bool writeDelays;           // Write the timing of the blocks after buffer placement
 
     std::map<std::string,blockID> name2block; // Map to obtain blocks from names
     std::map<std::string,portID> name2port;   // Map to obtain ports from names (string = "block:port")
 
+    // Interned names of the ports. Most ports share a few local names (in1, out1, ...),
+    // so they are stored once. A deque keeps the references valid when growing.
+    std::deque<std::string> portNames;
+    std::unordered_map<std::string,int> portName2index;
+
+    // Compact (CSR) representation of the connectivity of the netlist, used by the
+    // graph traversals. The adjacent blocks of block b are stored in the range
+    // [outStart[b], outStart[b+1]) of outBlock/outChannel (same for inputs), in the
+    // same order as the ports of the block. It is rebuilt lazily after any
+    // structural change of the netlist.
+    struct CompactGraph {
+        bool valid = false;                 // Is the representation up to date?
+        std::vector<int> outStart;          // Range of successors of each block
+        std::vector<blockID> outBlock;      // Successor blocks
+        std::vector<channelID> outChannel;  // Channels to the successor blocks
+        std::vector<int> inStart;           // Range of predecessors of each block
+        std::vector<blockID> inBlock;       // Predecessor blocks
+        std::vector<channelID> inChannel;   // Channels from the predecessor blocks
+    };
+
+    mutable CompactGraph compact;
+
+    // Changes of the netlist since the last calculation of the SCCs and the back
+    // edges, so that they are only recalculated in the modified region (see
+    // computeSCC and calculateBackEdges). The changes are only recorded while
+    // the previous results are valid, and the results are invalidated when the
+    // changes grow beyond the size of the netlist.
+    struct IncrementalInfo {
+        bool sccValid = false;                  // Are SCC and the SCC numbers valid (except for the changes below)?
+        bool sccOnlyMarked = false;             // Were the SCCs calculated with the marked blocks and channels only?
+        std::vector<int> splitSCCs;             // SCCs that lost blocks or channels
+        std::vector<channelID> newChannels;     // Channels created (or marked) in the netlist
+        std::vector<blockID> newBlocks;         // Blocks marked in the netlist
+        bool backEdgesValid = false;            // Are the back edges valid (except for the channels below)?
+        std::vector<channelID> backEdgeChannels; // Channels whose back-edge property must be recalculated
+    };
+
+    IncrementalInfo incremental;
+
     // Maps from/to blokcs/ports to strings
     static std::map<BlockType,std::string> BlockType2String;
     static std::map<std::string,BlockType> String2BlockType;
@@ -1613,6 +2302,28 @@ private:
 
     std::vector<subNetlist> MG;     // Extracted marked graphs in order of importance
     std::vector<double> MGfreq;     // Execution frequency of Marked Graphs
+    std::map<int, double> MGthroughput; // Throughput achieved by each CFDFC after buffer placement
+
+    // Structures for storing info after the buffer adding flow
+    // Jiantao, 18/05/2022
+    std::vector<subNetlistPostBuffer> MG_post_buffer;       // Extracted marked graphs in order of importance
+    std::vector<graphAdjrecord> MA;                         // Extracted Marked Graph's adjacency matrix
+    std::vector<mgPathInfo> MP;                             // Important paths in the extracted Marked Graph
+    std::vector<mgPathInfo> MP_BB;                          // Paths to the start of the BBs of each MG (for TBB)
+    std::set<bbID> AG;                                      // Used to store processed BB
+    std::vector<blockID> Start_points;                      // Used to store the start point of the path finding process
+    std::vector<blockID> End_points_Load_queue;             // Used to store load_nodes that are connected to the LSQ
+    std::vector<blockID> End_points_Store_queue;            // Used to store store_nodes that are connected to the LSQ
+    std::vector<blockID> End_points;                        // Used to store nodes that are connected to the LSQ
+    std::vector<blockID> End_points_MGs;                    // Used to store branchC nodes in each MG
+    std::vector<timeInfo> TL_traces;                        // Used to store TL traces for all MGs separately
+    std::vector<BB_info> BB_StartPoints;                    // Used to store start points of different BBs in different MGs
+    std::vector<int> T_iter;                                // Used to store Titer for different MGs
+    std::vector<vector<int>> II_traces;                     // Used to store all II values for different MGs
+    std::vector<pair<double, double>> Throughput_traces;    // Used to store best(first) and worst(second) throughput of the MG
+    std::vector<BB_info> T_BB;                              // Used to store Tbb in different MGs
+    std::set<channelID> loopback_edge;                      // Used to store the ID of all those loopback edges
+
 
     setBlocks blocks_in_MGs;
     setChannels channels_in_MGs;
@@ -1635,24 +2346,80 @@ private:
 
     std::vector<vector<int> > components;  // each index corresponds to the CFDFCs the DSU_CFDFC is built of
 
+    // Map from the identifiers of the netlist (blocks, ports or channels) to the
+    // MILP variables associated to them. Only the identifiers with a variable are
+    // stored, so the variables of a marked graph take memory proportional to the
+    // size of the marked graph and not to the size of the netlist.
+    class milpVarMap {
+    public:
+        // Variable of an identifier (-1 if it has none)
+        int operator[](int id) const {
+            auto it = vars.find(id);
+            return it == vars.end() ? -1 : it->second;
+        }
+
+        // Variable of an identifier, to be assigned (created as -1 if it has none)
+        int& operator[](int id) {
+            auto it = vars.find(id);
+            if (it == vars.end()) it = vars.insert(std::make_pair(id, -1)).first;
+            return it->second;
+        }
+
+        void clear() { vars.clear(); }
+        void reserve(int n) { vars.reserve(n); }
+        int size() const { return vars.size(); }
+
+    private:
+        std::unordered_map<int,int> vars;
+    };
+
     // Structure to store the MILP variables
     // Note: the out_retime variables are only used for pipelined units (latency > 0)
     struct milpVarsEB {
-        vector<int> buffer_flop;        // Elastic buffer to cut combinational paths
-        vector<int> buffer_flop_valid;        //Carmine 17.02.22 // Elastic buffer to cut combinational valid paths
-        vector<int> buffer_flop_ready;        //Carmine 17.02.22 // Elastic buffer to cut combinational ready paths
-        vector<int> buffer_slots;       // Number of slots of the elastic buffer
-        vector<int> has_buffer;         // Boolean variable to indicate whether there is a buffer
-        vector<int> time_path;          // Combinational arrival time for ports
-        vector<int> time_valid_path;    //Carmine 16.02.22 // Combinational arrival time for valid ports
-        vector<int> time_ready_path;    //Carmine 17.02.22 // Combinational arrival time for ready ports
-        vector<int> time_elastic;       // Arrival time for elasticity (longest rigid fragment)
-        vector<vector<int>> in_retime_tokens;  // Input retiming variables for tokens (indices: [MarkedGraph,block])
-        vector<vector<int>> out_retime_tokens; // Output retiming variables for tokens (indices: [MarkedGraph,block]).
-        vector<vector<int>> retime_bubbles;    // Retiming variables for bubbles (indices: [MarkedGraph,block])
-        vector<vector<int>> th_tokens;  // Throughput associated to every channel for tokens (indices: [MargedGraph, channel])
-        vector<vector<int>> th_bubbles; // Throughput associated to every channel for bubbles (indices: [MargedGraph, channel])
+        milpVarMap buffer_flop;         // Elastic buffer to cut combinational paths
+        milpVarMap buffer_flop_valid;   //Carmine 17.02.22 // Elastic buffer to cut combinational valid paths
+        milpVarMap buffer_flop_ready;   //Carmine 17.02.22 // Elastic buffer to cut combinational ready paths
+        milpVarMap buffer_slots;        // Number of slots of the elastic buffer
+        milpVarMap has_buffer;          // Boolean variable to indicate whether there is a buffer
+        milpVarMap time_path;           // Combinational arrival time for ports
+        milpVarMap time_valid_path;     //Carmine 16.02.22 // Combinational arrival time for valid ports
+        milpVarMap time_ready_path;     //Carmine 17.02.22 // Combinational arrival time for ready ports
+        milpVarMap time_elastic;        // Arrival time for elasticity (longest rigid fragment)
+        vector<milpVarMap> in_retime_tokens;  // Input retiming variables for tokens (indices: [MarkedGraph,block])
+        vector<milpVarMap> out_retime_tokens; // Output retiming variables for tokens (indices: [MarkedGraph,block]).
+        vector<milpVarMap> retime_bubbles;    // Retiming variables for bubbles (indices: [MarkedGraph,block])
+        vector<milpVarMap> th_tokens;   // Throughput associated to every channel for tokens (indices: [MargedGraph, channel])
+        vector<milpVarMap> th_bubbles;  // Throughput associated to every channel for bubbles (indices: [MargedGraph, channel])
         vector<int> th_MG;              // Throughput variables (one for each marked graph)
+        vector<channelID> border_channels; // Channels in the borders connected to the disjoint MG (sorted)
+        vector<blockID> border_blocks;     // Blocks in the borders connected to the disjoint MG (sorted)
+    };
+
+    // Buffer placement of a disjoint marked graph (the part of the MILP solution
+    // applied to the netlist, which is what the buffer cache stores)
+    struct bufferSolutionMG {
+        struct buffer {
+            channelID c;            // Buffered channel
+            int slots;              // Number of slots
+            bool transparent;       // Transparency of the buffer
+            bool eb;                // Whether an opaque slot is needed to cut the ready path
+        };
+        vector<buffer> buffers;                 // Buffers in the order they are applied
+        vector<pair<blockID,double>> retiming;  // Retiming diffs of the blocks
+        vector<double> throughput;              // Throughput of the sub MGs (same order as in components)
+    };
+
+    // Outcome of the buffer MILP of a disjoint marked graph
+    struct milpResultMG {
+        Milp_Model milp;            // MILP model (with the solution)
+        milpVarsEB vars;            // MILP variables of the model
+        ErrorMgr error;             // Error produced while building or solving the model
+        bool solved = false;        // Whether a solution was found
+        bool cached = false;        // Whether the solution was found in the buffer cache
+        std::string cache_key;      // Description of the MILP in the buffer cache
+        bufferSolutionMG solution;  // Buffer placement (from the model or from the cache)
+        long long build_time = 0;   // Time to build the model [ms]
+        long long solve_time = 0;   // Time to solve the model [ms]
     };
 
     /**
@@ -1699,6 +2466,21 @@ private:
      */
     bool readDataflowDot(FILE* f);
 
+    /**
+     * @brief Reads a dataflow netlist from a graph of graphviz
+     * (used for both the dot and the binary files).
+     * @param g The graph.
+     * @return True if no errors, and false otherwise.
+     */
+    bool readDataflowGraph(Agraph_s* g);
+
+    /**
+     * @brief Reads a dataflow netlist in binary format (see NetlistBinary.h).
+     * @param filename Name of the file.
+     * @return True if no errors, and false otherwise.
+     */
+    bool readDataflowBinary(const std::string& filename);
+
     bool readDataflowDotBB(FILE *f);
     bool readDataflowDotBB(const std::string& filename);
 
@@ -1894,6 +2676,7 @@ private:
      */
     void markAllBlocks(bool value) {
         ForAllBlocks(b) blocks[b].mark = value;
+        if (incremental.sccOnlyMarked) incremental.sccValid = false;
     }
 
     /**
@@ -1902,6 +2685,7 @@ private:
      */
     void markAllChannels(bool value) {
         ForAllChannels(c) channels[c].mark = value;
+        if (incremental.sccOnlyMarked) incremental.sccValid = false;
     }
 
     /**
@@ -1911,6 +2695,10 @@ private:
      */
     void markBlock(blockID b, bool value) {
         assert(validBlock(b));
+        if (blocks[b].mark != value and incremental.sccOnlyMarked) {
+            if (value) noteAddedBlock(b);
+            else noteRemovedConnection(b, b);
+        }
         blocks[b].mark = value;
     }
 
@@ -1940,6 +2728,10 @@ private:
      */
     void markChannel(channelID c, bool value) {
         assert(validChannel(c));
+        if (channels[c].mark != value and incremental.sccOnlyMarked) {
+            if (value) noteAddedChannel(c, false);
+            else noteRemovedConnection(getSrcBlock(c), getDstBlock(c));
+        }
         channels[c].mark = value;
     }
 
@@ -1972,6 +2764,7 @@ private:
     void setBackEdge(channelID c, bool value = true) {
         assert(validChannel(c));
         channels[c].backEdge = value;
+        noteBackEdgeChannel(c);
     }
 
     /**
@@ -2002,13 +2795,77 @@ private:
 
     /**
       * @brief Computes the SCCs of the netlist. The SCCs with more than one block
-      * are stored in the SCC vector in descending order of size.
+      * are stored in the SCC vector in descending order of size (SCCs with the
+      * same size are ordered by their smallest block). If the netlist has only
+      * been modified locally since the last call (with the same onlyMarked),
+      * only the SCCs of the modified region are recalculated.
       * @param onlyMarked If asserted, it only visits the blocks and channels
       * that are marked. Otherwise, all blocks and channels are visited.
-      * @note The method recalculates the DFS order of all blocks.
+      * @note When the SCCs are recalculated from scratch, the DFS order of all
+      * blocks is recalculated.
       */
     void computeSCC(bool onlyMarked = false);
 
+    /**
+     * @brief Recalculates the SCCs in the region of the netlist modified
+     * since the last calculation (see IncrementalInfo).
+     * @param onlyMarked Same as in computeSCC.
+     * @return True if successful, and false if the SCCs must be recalculated
+     * from scratch (the modified region is too large).
+     */
+    bool updateSCC(bool onlyMarked);
+
+    /**
+     * @brief Sorts the SCCs and assigns the SCC numbers of their blocks.
+     */
+    void sortSCC();
+
+    /**
+     * @brief Records that the connection between two blocks has been removed
+     * (the SCC containing both blocks may have been split).
+     */
+    void noteRemovedConnection(blockID src, blockID dst);
+
+    /**
+     * @brief Records a new channel (it may create new cycles).
+     * @param c Id of the channel.
+     * @param backEdge Whether its back-edge property must be also calculated.
+     */
+    void noteAddedChannel(channelID c, bool backEdge = true);
+
+    /**
+     * @brief Records a new marked block (it may create new cycles).
+     */
+    void noteAddedBlock(blockID b);
+
+    /**
+     * @brief Records a channel whose back-edge property must be recalculated.
+     */
+    void noteBackEdgeChannel(channelID c);
+
+    /**
+     * @brief Returns the compact representation of the connectivity of the
+     * netlist. It is recalculated if the netlist has been modified.
+     * @return The compact graph.
+     */
+    const CompactGraph& getCompactGraph() const;
+
+    /**
+     * @brief Invalidates the compact representation of the connectivity.
+     * This is required when blocks, ports or channels are created or removed.
+     */
+    void invalidateCompactGraph() {
+        compact.valid = false;
+    }
+
+    /**
+     * @brief Returns the index of an interned port name. The name is
+     * added to the table if it did not exist.
+     * @param name The local name of the port.
+     * @return The index of the name in portNames.
+     */
+    int internPortName(const std::string& name);
+
     /**
      * @return The name of the MILP solver used for optimization problems.
      */
@@ -2016,6 +2873,27 @@ private:
         return milpSolver;
     }
 
+    /**
+     * @return The max number of MILP models solved concurrently.
+     */
+    int getMilpThreads() const {
+        return milpThreads;
+    }
+
+    /**
+     * @return The directory of the buffer cache (empty if disabled).
+     */
+    const std::string& getBufferCache() const {
+        return bufferCacheDir;
+    }
+
+    /**
+     * @return True if the timing of the blocks is written after buffer placement.
+     */
+    bool getWriteDelays() const {
+        return writeDelays;
+    }
+
     /**
      * @brief Creates the variables of an MILP model for the insertion of buffers.
      * @param milp MILP model.
@@ -2042,7 +2920,7 @@ private:
     bool createPathConstraintsOthers_remaining(Milp_Model& milp, milpVarsEB& Vars, double Period, double BufferDelay, string model_mode, string lib_path);
 
 
-    vector< pair<string, vector<double>>> read_lib_file(string lib_file_path); //Carmine 18.02.22 function to read block delays values from library
+    const vector< pair<string, vector<double>>>& read_lib_file(string lib_file_path); //Carmine 18.02.22 function to read block delays values from library (cached)
     /**
      * @brief Creates the elasticity constraints for the MILP model. The constraints
      * ensure that every cycle will have one elastic buffer at least (maybe transparent).
@@ -2066,6 +2944,23 @@ private:
     bool createThroughputConstraints(Milp_Model& milp, milpVarsEB& Vars, bool first_MG= false);
     bool createThroughputConstraints_sc(Milp_Model& milp, milpVarsEB& Vars, int mg, bool first_MG= false);
 
+    /**
+     * @brief Builds and solves the buffer MILP of a disjoint marked graph. It only
+     * reads the netlist, so that the models of different marked graphs can be
+     * built and solved concurrently. The solution is not applied to the netlist.
+     * @param res Structure that receives the model, the variables and the timing.
+     * @param mg Index of the disjoint marked graph.
+     * @return True if a solution was found, and false otherwise.
+     */
+    bool solveMilpEB_sc(milpResultMG& res, int mg, double Period, double BufferDelay, bool MaxThroughput,
+                        int timeout, bool first_MG, const std::string& model_mode, const std::string& lib_path);
+
+    /**
+     * @brief Redirects the errors produced by the calling thread to another error manager.
+     * @param err Error manager receiving the errors (nullptr to restore the netlist one).
+     */
+    static void redirectThreadErrors(ErrorMgr* err);
+
     bool channelIsInMGs(channelID c);
     bool blockIsInMGs(blockID b);
 
@@ -2084,7 +2979,41 @@ private:
      */
     void dumpMilpSolution(const Milp_Model& milp, const milpVarsEB& vars) const;
 
-    void writeRetimingDiffs(const Milp_Model& milp, const milpVarsEB& vars);
+    /**
+     * @brief Extracts the buffer placement of a disjoint marked graph from the
+     * solution of its MILP, without modifying the netlist.
+     * @param res Outcome of the MILP, whose solution field is filled.
+     * @param mg Index of the disjoint marked graph.
+     */
+    void getBufferSolutionMG(milpResultMG& res, int mg, bool MaxThroughput, bool first_MG, const std::string& model_mode);
+
+    /**
+     * @brief Describes everything the buffer MILP of a disjoint marked graph depends on:
+     * its blocks, ports and channels (and the ones around it), the sub MGs, the
+     * parameters of the model and the delay library. Two MGs with the same
+     * description get the same buffer placement.
+     * @param mg Index of the disjoint marked graph.
+     * @return The description (the key of the buffer cache).
+     */
+    std::string describeMilpEB_sc(int mg, double Period, double BufferDelay, bool MaxThroughput, bool first_MG,
+                                  const std::string& model_mode, const std::string& lib_path);
+
+    /**
+     * @brief Looks up a buffer placement in the buffer cache.
+     * @param key Description of the MILP (see describeMilpEB_sc).
+     * @param mg Index of the disjoint marked graph.
+     * @param sol Buffer placement, only valid if found.
+     * @return True if found, and false otherwise.
+     */
+    bool readBufferCache(const std::string& key, int mg, bufferSolutionMG& sol) const;
+
+    /**
+     * @brief Stores a buffer placement in the buffer cache.
+     * @param key Description of the MILP (see describeMilpEB_sc).
+     * @param sol Buffer placement.
+     * @return True if successful, and false otherwise (the cache is only an optimization).
+     */
+    bool writeBufferCache(const std::string& key, const bufferSolutionMG& sol) const;
 
     /**
      * @brief Makes some buffers non-transparent to cut combinational cycles.
@@ -2151,6 +3080,69 @@ private:
      */
     void invalidateBasicBlocks();
 
+    // Functions for path finding
+    // Jiantao 04/05/2022
+    /**
+     * @brief Rebuild structure for storing adjacent matrixs info which will be used for DFS
+     * path searching.
+     * @param Marked_Graphs Extracted marked graphs from the CDFG.
+     * @return The process succeeds or not.
+     */
+    bool getAdjRecordfromMGs(std::vector<subNetlistPostBuffer> &Marked_Graphs);
+
+    subNetlist blocksExtractionsingleBB(bbID BB_index);
+
+    bool checkConnectionSingleBB(blockID src_block, blockID dst_block);
+
+    blockID addConnectionToPhiBB(subNetlist &sel_MG, bbID BB_index);
+
+    mgPathInfo findPathsinMG(const graphAdjrecord &sel_MG, blockID start_block, blockID end_block, int type_selection, int MG_index);
+
+    void orderMGfromBlock(const graphAdjrecord &sel_MG, int start, std::vector<int> &order, std::vector<char> &in_dag);
+
+    void blockPathLatency(blockID sel_block, int &lat_total, int &Buffer_flag);
+
+    mgPathInfo findLongestPathsinMG(const graphAdjrecord &sel_MG, blockID start_block, const std::vector<blockID> &end_blocks, int MG_index);
+
+    mgPathInfo findShortestPathinMG(const graphAdjrecord &sel_MG, blockID start_block, blockID end_block);
+
+    int pathLatency(std::vector<blockID> node_set, int MG_index);
+
+    int sim_path_latency_cal(std::vector<blockID> sel_path, int MG_index);
+
+    bool prepareLSQSizing(double coverage);
+
+    bool readLSQThroughput(const std::string& dot_name, int selected_case, std::vector<std::string>& throughput_var_value);
+
+    bool computeLSQDepths(int selected_case, const std::vector<std::string>& throughput_var_value,
+                          int& opt_load_depth, int& opt_store_depth);
+
+    void extractLSQnodes(subNetlistPostBuffer &sel_MG);
+
+    std::pair<int, int> countNumMemOps(bbID BB_index, subNetlistPostBuffer &sel_MG);
+
+    void print_main_stack(std::vector<blockID> S1);
+
+    void print_adj_stack(std::vector< std::set<blockID> > S2);
+
+    bool check_spi_node(std::vector<blockID> &block_list, BlockType sel_type, std::string &sel_op, int op_flag);
+
+    bool check_for_icmp_node(std::vector<blockID> sel_path);
+    
+    int optLoadDepCal(int MG_index, int case_selection, std::vector<string> throughput_var);
+
+    int optStoreDepCal(int MG_index, int case_selection, std::vector<string> throughput_var);
+
+    bool loopbackChange(subNetlistPostBuffer &sel_MG, int MG_index);
+
+    void del_edge_MGs(channelID sel_channel);
+
+    int parse_alph_string_load(string input_sequence, int marker, int MG_index);
+
+    int parse_alph_string_store(string input_sequence, int marker, int MG_index);
+
+    double get_II_base(string input_sequence);
+
     /**
      * @brief Calculates the set of definitions reaching each port.
      * @note Each port receives the set of ports that define some data.
@@ -2168,13 +3160,34 @@ private:
      */
     subNetlist extractMarkedGraph(const map<blockID, double>& freq);
 
+    // MILP model to extract the CFDFCs of the control flow netlist.
+    // The model is created once and re-solved after updating the frequencies.
+    struct milpVarsCFDFC {
+        Milp_Model milp;                // The MILP model
+        vector<int> S_BB;               // Variables to model BB presence
+        vector<int> S_e;                // Variables to model edge presence
+        vector<int> NxS_e;              // Variables to model N * S_e
+        int N;                          // Variable to model CFDFC frequency
+        vector<int> row_N_e;            // Rows bounding N by the frequency of each edge
+        double N_max;                   // Big-M constant (max initial frequency)
+    };
+
+    /**
+     * @brief Creates the MILP model to extract CFDFCs from the control flow netlist.
+     * Edges with no initial frequency are not included in the model.
+     * @param freq A map indicating the initial execution frequency of the arcs.
+     * @param vars The MILP model and its variables (output).
+     */
+    void createMilpCFDFC(const map<bbArcID, double>& freq, milpVarsCFDFC& vars);
+
     /**
      * @brief Extracts one marked graph from the control flow netlist maximizing the
      * execution frequency of the components.
-     * @param freq A map indicating the execution frequency of the Basic Blocks.
+     * @param freq A map indicating the residual execution frequency of the arcs.
+     * @param vars The MILP model, updated with the residual frequencies.
      * @return A set of channels that identify the extracted marked graph.
      */
-    subNetlistBB extractMarkedGraphBB(const map<bbID, double>& freq);
+    subNetlistBB extractMarkedGraphBB(const map<bbArcID, double>& freq, milpVarsCFDFC& vars);
 
     /**
      * @brief Calculates the blocks and channels corresponding to a graph of Basic Blocks and Arcs.
@@ -2183,6 +3196,10 @@ private:
      */
     subNetlist getMGfromCFDFC(subNetlistBB &BB_CFDFC);
 
+    // Jiantao, 17/05/2022
+    // Same function as above for the LSQ flow
+    subNetlistPostBuffer getMGfromCFDFC_post_Buffer(subNetlistBB &BB_CFDFC);
+
     void calculateDisjointCFDFCs();
     int findCFDFC(int i);
     void unionCFDFC(int x, int y);
@@ -15,8 +15,12 @@ double BasicBlockGraph::extractBasicBlockCycles(double coverage)
 
     double coveredTime = 0;
 
+    // The model is built once and updated at every iteration
+    CycleModel CM;
+    createCycleModel(CM);
+
     while (coveredTime < coverage*execTime) {
-        BasicBlockCycle C = extractBasicBlockCycle();
+        BasicBlockCycle C = extractBasicBlockCycle(CM);
         if (C.exec == 0.0) break;
         cycles.push_back(C);
         coveredTime += C.exec;
@@ -42,31 +46,35 @@ double BasicBlockGraph::extractBasicBlockCycles(double coverage)
     return coveredTime/execTime;
 }
 
-BasicBlockGraph::BasicBlockCycle BasicBlockGraph::extractBasicBlockCycle()
+void BasicBlockGraph::createCycleModel(CycleModel& CM)
 {
-
     int nBBs = numBasicBlocks();
 
-    // Let us calculate the max execution frequency of all blocks
+    // The initial max execution frequency of all blocks is used as big-M
     double maxFreq = 0;
     ForAllBasicBlocks(bb) {
         maxFreq = max(maxFreq, BBs[bb].residual_freq);
     }
 
     // Boolean variables for the presence and execution of blocks
-    vector<int> presenceBB(nBBs);   // Presence of each block
-    vector<int> execBB(nBBs);       // Execution of each block
+    CM.presenceBB.assign(nBBs, -1);
+    CM.execBB.assign(nBBs, -1);
 
     // Boolean variables representing arcs of the BBs
-    vector<vector<int>> arcBB(nBBs, vector<int>(nBBs, -1));
+    CM.arcBB.assign(nBBs, vector<int>(nBBs, -1));
+
+    // Rows with the residual frequency of each block
+    CM.rowResidual.assign(nBBs, -1);
 
     // Variables to represent the product Freq*execBB
     vector<int> FreqExec(nBBs);
 
-    Milp_Model M; // The MILP model
+    Milp_Model& M = CM.milp; // The MILP model
+    M.init();
 
     // Execution frequency of the cycle
-    int Freq = M.newRealVar("", 0, maxFreq);
+    CM.Freq = M.newRealVar("", 0, maxFreq);
+    int Freq = CM.Freq;
 
     // Total execution time of the cycle
     int Exec = M.newRealVar();
@@ -77,9 +85,9 @@ BasicBlockGraph::BasicBlockCycle BasicBlockGraph::extractBasicBlockCycle()
     // Let us create the variables for the cycle
     ForAllBasicBlocks(bb) {
         FreqExec[bb] = M.newRealVar();
-        presenceBB[bb] = M.newBooleanVar();
-        execBB[bb] = M.newBooleanVar();
-        for (bbArcID arc: successors(bb)) arcBB[bb][getDstBB(arc)] = M.newBooleanVar();
+        CM.presenceBB[bb] = M.newBooleanVar();
+        CM.execBB[bb] = M.newBooleanVar();
+        for (bbArcID arc: successors(bb)) CM.arcBB[bb][getDstBB(arc)] = M.newBooleanVar();
     }
 
     // Constraints to model cycles
@@ -87,29 +95,29 @@ BasicBlockGraph::BasicBlockCycle BasicBlockGraph::extractBasicBlockCycle()
 
     ForAllBasicBlocks(bb) {
         // execBB => presenceBB
-        int varBB = presenceBB[bb];
-        M.implies(execBB[bb], {varBB});
+        int varBB = CM.presenceBB[bb];
+        M.implies(CM.execBB[bb], {varBB});
 
         // Sum of predecessors = presence
         sum.clear();
-        for (bbArcID arc: predecessors(bb)) sum.push_back(arcBB[getSrcBB(arc)][bb]);
+        for (bbArcID arc: predecessors(bb)) sum.push_back(CM.arcBB[getSrcBB(arc)][bb]);
         M.equalSum( {varBB}, sum);
 
         // Sum of successors = presence
         sum.clear();
-        for (bbArcID arc: successors(bb)) sum.push_back(arcBB[bb][getDstBB(arc)]);
+        for (bbArcID arc: successors(bb)) sum.push_back(CM.arcBB[bb][getDstBB(arc)]);
         M.equalSum( {varBB}, sum);
     }
 
     // Constraints to model the equality FreqExec[bb] = Freq*execBB[bb]
     ForAllBasicBlocks(bb) {
         M.newRow( {{1,FreqExec[bb]},{-1,Freq}}, '<', 0);
-        M.newRow( {{1,FreqExec[bb]},{-maxFreq,execBB[bb]}}, '<', 0);
-        M.newRow( {{1,FreqExec[bb]},{-1,Freq},{-maxFreq,execBB[bb]}}, '>', -maxFreq);
+        M.newRow( {{1,FreqExec[bb]},{-maxFreq,CM.execBB[bb]}}, '<', 0);
+        M.newRow( {{1,FreqExec[bb]},{-1,Freq},{-maxFreq,CM.execBB[bb]}}, '>', -maxFreq);
     }
 
-    // Constraints to bound the execution frequency
-    ForAllBasicBlocks(bb) M.newRow( {{1,FreqExec[bb]}}, '<', BBs[bb].residual_freq);
+    // Constraints to bound the execution frequency (RHS updated at every iteration)
+    ForAllBasicBlocks(bb) CM.rowResidual[bb] = M.newRow( {{1,FreqExec[bb]}}, '<', BBs[bb].residual_freq);
 
     // Exec = SUM FreqExec*Exectime
     int row_exec = M.newRow('=', 0);
@@ -117,13 +125,40 @@ BasicBlockGraph::BasicBlockCycle BasicBlockGraph::extractBasicBlockCycle()
     ForAllBasicBlocks(bb) M.newTerm(row_exec, getExecTime(bb), FreqExec[bb]);
 
     // totalBBs = SUM presenceBB
-    M.equalSum(presenceBB, {totalBBs});
+    M.equalSum(CM.presenceBB, {totalBBs});
 
     M.newCostTerm(1, Exec);
     M.newCostTerm(-0.01, totalBBs); // To minimize the number of inactive blocks
     M.setMaximize();
 
+    // The cycle of the previous iteration is a good initial solution
+    M.setWarmStart();
+}
+
+BasicBlockGraph::BasicBlockCycle BasicBlockGraph::extractBasicBlockCycle(CycleModel& CM)
+{
+
+    int nBBs = numBasicBlocks();
+
+    // Let us calculate the max execution frequency of all blocks
+    double maxFreq = 0;
+    ForAllBasicBlocks(bb) {
+        maxFreq = max(maxFreq, BBs[bb].residual_freq);
+    }
+
+    // Update the model with the residual frequencies
+    Milp_Model& M = CM.milp;
+    M.setBounds(CM.Freq, 0, maxFreq);
+    ForAllBasicBlocks(bb) M.setRHS(CM.rowResidual[bb], BBs[bb].residual_freq);
+
+    const vector<int>& presenceBB = CM.presenceBB;
+    const vector<int>& execBB = CM.execBB;
+    const vector<vector<int>>& arcBB = CM.arcBB;
+
     M.solve();
+    if (M.getStatus() != Milp_Model::OPTIMAL and M.getStatus() != Milp_Model::NONOPTIMAL) {
+        return BasicBlockCycle {0,0};
+    }
 
     // There can be multiple disjoint cycles. Let us take the best one.
     // This vector is to keep track of the BBs already extracted
@@ -6,8 +6,56 @@
 using namespace Dataflow;
 using namespace std;
 
+const DFnetlist_Impl::CompactGraph& DFnetlist_Impl::getCompactGraph() const
+{
+    if (compact.valid) return compact;
+
+    CompactGraph& G = compact;
+    int nb = blocks.size();
+    G.outStart.assign(nb + 1, 0);
+    G.inStart.assign(nb + 1, 0);
+    G.outBlock.clear();
+    G.outChannel.clear();
+    G.inBlock.clear();
+    G.inChannel.clear();
+    G.outBlock.reserve(nChannels);
+    G.outChannel.reserve(nChannels);
+    G.inBlock.reserve(nChannels);
+    G.inChannel.reserve(nChannels);
+
+    // The adjacencies are stored in the order of the ports of each block,
+    // so that the traversals visit the blocks in the same order as with getPorts.
+    for (blockID b = 0; b < nb; ++b) {
+        G.outStart[b] = G.outBlock.size();
+        G.inStart[b] = G.inBlock.size();
+        if (not validBlock(b)) continue;
+        for (portID p: blocks[b].outPorts) {
+            channelID c = ports[p].channel;
+            if (c == invalidDataflowID) continue;
+            G.outBlock.push_back(ports[channels[c].dst].block);
+            G.outChannel.push_back(c);
+        }
+        for (portID p: blocks[b].inPorts) {
+            channelID c = ports[p].channel;
+            if (c == invalidDataflowID) continue;
+            G.inBlock.push_back(ports[channels[c].src].block);
+            G.inChannel.push_back(c);
+        }
+    }
+    G.outStart[nb] = G.outBlock.size();
+    G.inStart[nb] = G.inBlock.size();
+
+    G.valid = true;
+    return G;
+}
+
 void DFnetlist_Impl::DFS(bool forward, bool onlyMarked)
 {
+    const CompactGraph& G = getCompactGraph();
+    const vector<int>& start = forward ? G.outStart : G.inStart;
+    const vector<blockID>& adjBlock = forward ? G.outBlock : G.inBlock;
+    const vector<channelID>& adjChannel = forward ? G.outChannel : G.inChannel;
+
     // Vector to detect the blocks that have been visited
     // or have been processed.
     vector<bool> visited(blocks.size());
@@ -40,11 +88,9 @@ void DFnetlist_Impl::DFS(bool forward, bool onlyMarked)
         // Put the children to the pending list. The lists of children
         // from different blocks are separated by an invalidDataflowID
         listChildren.push(invalidDataflowID);
-        const setPorts& ports = getPorts(b, (forward ? OUTPUT_PORTS : INPUT_PORTS));
-        for (portID p: ports) {
-            channelID c = getConnectedChannel(p);
-            if (onlyMarked and not isChannelMarked(c)) continue; // Skip if the channel is not marked
-            blockID other_b = getBlockFromPort(getConnectedPort(p));
+        for (int i = start[b]; i < start[b+1]; ++i) {
+            if (onlyMarked and not isChannelMarked(adjChannel[i])) continue; // Skip if the channel is not marked
+            blockID other_b = adjBlock[i];
             if (not visited[other_b]) listChildren.push(other_b);
         }
 
@@ -60,11 +106,9 @@ void DFnetlist_Impl::DFS(bool forward, bool onlyMarked)
                 S.push(kid);
                 visited[kid] = true;
                 listChildren.push(invalidDataflowID);
-                const setPorts& ports = getPorts(kid, (forward ? OUTPUT_PORTS : INPUT_PORTS));
-                for (portID p: ports) {
-                    channelID c = getConnectedChannel(p);
-                    if (onlyMarked and not isChannelMarked(c)) continue; // Skip if the channel is not marked
-                    blockID other_b = getBlockFromPort(getConnectedPort(p));
+                for (int i = start[kid]; i < start[kid+1]; ++i) {
+                    if (onlyMarked and not isChannelMarked(adjChannel[i])) continue; // Skip if the channel is not marked
+                    blockID other_b = adjBlock[i];
                     if (not visited[other_b]) listChildren.push(other_b);
                 }
             }
@@ -83,6 +127,16 @@ void DFnetlist_Impl::DFS(bool forward, bool onlyMarked)
 
 void DFnetlist_Impl::computeSCC(bool onlyMarked)
 {
+    IncrementalInfo& I = incremental;
+    bool updated = I.sccValid and I.sccOnlyMarked == onlyMarked and updateSCC(onlyMarked);
+
+    I.sccValid = true;
+    I.sccOnlyMarked = onlyMarked;
+    I.splitSCCs.clear();
+    I.newChannels.clear();
+    I.newBlocks.clear();
+    if (updated) return;
+
     DFS(false, onlyMarked); // DFS with the reverse graph
 
     SCC.clear();
@@ -94,6 +148,7 @@ void DFnetlist_Impl::computeSCC(bool onlyMarked)
     }
 
     stack<blockID> s;
+    const CompactGraph& G = getCompactGraph();
 
     // Visit the nodes in DFS post-visit order
     // We add channels to the SCCs (the blocks are implicit)
@@ -110,10 +165,10 @@ void DFnetlist_Impl::computeSCC(bool onlyMarked)
         while (not s.empty()) {
             blockID v = s.top();
             s.pop();
-            ForAllOutputPorts(v, p) {
-                channelID c = getConnectedChannel(p);
+            for (int i = G.outStart[v]; i < G.outStart[v+1]; ++i) {
+                channelID c = G.outChannel[i];
                 if (onlyMarked and not isChannelMarked(c)) continue; // Skip if the channel is not marked
-                blockID other_b = getBlockFromPort(getConnectedPort(p));
+                blockID other_b = G.outBlock[i];
                 if (not visited[other_b]) {
                     visited[other_b] = true;
                     s.push(other_b);
@@ -126,17 +181,8 @@ void DFnetlist_Impl::computeSCC(bool onlyMarked)
         if (SCC.back().empty()) SCC.pop_back();
     }
 
-    // Sort the SCCs according to their size (largest first)
-    sort(SCC.begin(), SCC.end(),
-    [](const subNetlist& s1, const subNetlist& s2) {
-        return s1.numBlocks() > s2.numBlocks();
-    });
-
-    // Assign SCC numbers to all blocks
     ForAllBlocks(b) blocks[b].scc_number = -1;
-    for (int n = 0; n < SCC.size(); ++n) {
-        for (blockID b: SCC[n].getBlocks()) blocks[b].scc_number = n;
-    }
+    sortSCC();
 
     // Revisit all channels and add all those that may also be inside the SCCs and have not been visited
     ForAllChannels(c) {
@@ -149,6 +195,245 @@ void DFnetlist_Impl::computeSCC(bool onlyMarked)
     }
 }
 
+void DFnetlist_Impl::sortSCC()
+{
+    // Sort the SCCs according to their size (largest first). The SCCs are
+    // moved by swapping, to avoid copying their sets.
+    vector<int> order(SCC.size());
+    for (int n = 0; n < SCC.size(); ++n) order[n] = n;
+    sort(order.begin(), order.end(),
+    [this](int n1, int n2) {
+        const subNetlist& s1 = SCC[n1];
+        const subNetlist& s2 = SCC[n2];
+        if (s1.numBlocks() != s2.numBlocks()) return s1.numBlocks() > s2.numBlocks();
+        return *s1.getBlocks().begin() < *s2.getBlocks().begin();
+    });
+
+    vector<subNetlist> sorted(SCC.size());
+    for (int n = 0; n < SCC.size(); ++n) sorted[n].swap(SCC[order[n]]);
+    SCC.swap(sorted);
+
+    // Assign SCC numbers to the blocks of the SCCs
+    for (int n = 0; n < SCC.size(); ++n) {
+        for (blockID b: SCC[n].getBlocks()) blocks[b].scc_number = n;
+    }
+}
+
+bool DFnetlist_Impl::updateSCC(bool onlyMarked)
+{
+    IncrementalInfo& I = incremental;
+    if (I.splitSCCs.empty() and I.newChannels.empty() and I.newBlocks.empty()) return true;
+
+    const CompactGraph& G = getCompactGraph();
+    int nb = blocks.size();
+    int limit = numBlocks() / 2; // Beyond this size, the SCCs are recalculated from scratch
+
+    auto activeBlock = [&](blockID b) {
+        return validBlock(b) and (not onlyMarked or isBlockMarked(b));
+    };
+    auto activeChannel = [&](channelID c) {
+        return not onlyMarked or isChannelMarked(c);
+    };
+
+    // The region is a union of (new) SCCs: the old SCCs that may have been split or
+    // may have new channels, and the blocks in the cycles created by the new
+    // channels or blocks. The rest of SCCs remain the same.
+    vector<bool> inRegion(nb, false);
+    vecBlocks region;
+    vector<bool> replaced(SCC.size(), false);
+
+    auto addSCC = [&](int n) {
+        if (n < 0 or n >= SCC.size() or replaced[n]) return;
+        replaced[n] = true;
+        for (blockID b: SCC[n].getBlocks()) {
+            if (validBlock(b) and not inRegion[b]) {
+                inRegion[b] = true;
+                region.push_back(b);
+            }
+        }
+    };
+
+    auto addBlock = [&](blockID b) {
+        addSCC(blocks[b].scc_number);
+        if (not inRegion[b]) {
+            inRegion[b] = true;
+            region.push_back(b);
+        }
+    };
+
+    for (int n: I.splitSCCs) addSCC(n);
+
+    // Seeds of the new cycles: they must go through a new channel (dst ->* src)
+    // or a new block
+    vecBlocks fwdSeeds, bwdSeeds;
+    for (channelID c: I.newChannels) {
+        if (not validChannel(c) or not activeChannel(c)) continue;
+        blockID src = getSrcBlock(c), dst = getDstBlock(c);
+        if (not activeBlock(src) or not activeBlock(dst)) continue;
+        addBlock(src);
+        addBlock(dst);
+        fwdSeeds.push_back(dst);
+        bwdSeeds.push_back(src);
+    }
+    for (blockID b: I.newBlocks) {
+        if (not activeBlock(b)) continue;
+        addBlock(b);
+        fwdSeeds.push_back(b);
+        bwdSeeds.push_back(b);
+    }
+
+    // Blocks reachable from the seeds (forward or backward)
+    auto reach = [&](const vecBlocks& seeds, bool forward, vector<bool>& reached) {
+        const vector<int>& start = forward ? G.outStart : G.inStart;
+        const vector<blockID>& adjBlock = forward ? G.outBlock : G.inBlock;
+        const vector<channelID>& adjChannel = forward ? G.outChannel : G.inChannel;
+        stack<blockID> S;
+        int count = 0;
+        for (blockID b: seeds) {
+            if (reached[b]) continue;
+            reached[b] = true;
+            S.push(b);
+        }
+        while (not S.empty()) {
+            blockID v = S.top();
+            S.pop();
+            if (++count > limit) return false;
+            for (int i = start[v]; i < start[v+1]; ++i) {
+                blockID other_b = adjBlock[i];
+                if (reached[other_b] or not activeChannel(adjChannel[i]) or not activeBlock(other_b)) continue;
+                reached[other_b] = true;
+                S.push(other_b);
+            }
+        }
+        return true;
+    };
+
+    if (not fwdSeeds.empty()) {
+        vector<bool> fwd(nb, false), bwd(nb, false);
+        if (not reach(fwdSeeds, true, fwd) or not reach(bwdSeeds, false, bwd)) return false;
+        ForAllBlocks(b) {
+            if (fwd[b] and bwd[b]) addBlock(b);
+        }
+    }
+
+    if (region.size() > limit) return false;
+
+    // SCCs of the region (same algorithm as computeSCC, restricted to the region):
+    // DFS with the reverse graph, and traversal of the graph in DFS post-visit order
+    vector<bool> visited(nb, false);
+    for (blockID b: region) visited[b] = not activeBlock(b);
+
+    vecBlocks order;
+    stack<pair<blockID,int>> S; // Block and next predecessor to visit
+    for (blockID b: region) {
+        if (visited[b]) continue;
+        visited[b] = true;
+        S.push(make_pair(b, G.inStart[b]));
+        while (not S.empty()) {
+            blockID v = S.top().first;
+            int& i = S.top().second;
+            if (i == G.inStart[v+1]) {
+                order.push_back(v);
+                S.pop();
+                continue;
+            }
+            channelID c = G.inChannel[i];
+            blockID other_b = G.inBlock[i++];
+            if (inRegion[other_b] and not visited[other_b] and activeChannel(c)) {
+                visited[other_b] = true;
+                S.push(make_pair(other_b, G.inStart[other_b]));
+            }
+        }
+    }
+
+    vector<int> component(nb, -1);
+    vector<vecBlocks> components;
+    stack<blockID> s;
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        if (component[*it] >= 0) continue;
+        int n = components.size();
+        components.push_back(vecBlocks());
+        component[*it] = n;
+        s.push(*it);
+        while (not s.empty()) {
+            blockID v = s.top();
+            s.pop();
+            components[n].push_back(v);
+            for (int i = G.outStart[v]; i < G.outStart[v+1]; ++i) {
+                blockID other_b = G.outBlock[i];
+                if (not inRegion[other_b] or component[other_b] >= 0 or not activeBlock(other_b)) continue;
+                if (not activeChannel(G.outChannel[i])) continue;
+                component[other_b] = n;
+                s.push(other_b);
+            }
+        }
+    }
+
+    // The new SCCs are the components with more than one block (as in computeSCC,
+    // a block with a self-loop is not an SCC)
+    vector<subNetlist> newSCC(components.size());
+    for (blockID v: region) {
+        blocks[v].scc_number = -1;
+        if (component[v] < 0 or components[component[v]].size() < 2) continue;
+        for (int i = G.outStart[v]; i < G.outStart[v+1]; ++i) {
+            channelID c = G.outChannel[i];
+            if (activeChannel(c) and component[G.outBlock[i]] == component[v]) newSCC[component[v]].insertChannel(*this, c);
+        }
+    }
+
+    vector<subNetlist> result;
+    for (int n = 0; n < SCC.size(); ++n) {
+        if (replaced[n]) continue;
+        result.push_back(subNetlist());
+        result.back().swap(SCC[n]);
+    }
+    for (subNetlist& scc: newSCC) {
+        if (scc.empty()) continue;
+        result.push_back(subNetlist());
+        result.back().swap(scc);
+    }
+
+    SCC.swap(result);
+    sortSCC();
+    return true;
+}
+
+void DFnetlist_Impl::noteRemovedConnection(blockID src, blockID dst)
+{
+    IncrementalInfo& I = incremental;
+    if (not I.sccValid) return;
+    int scc = blocks[src].scc_number;
+    if (scc < 0 or scc != blocks[dst].scc_number) return;
+    I.splitSCCs.push_back(scc);
+    if (I.splitSCCs.size() > blocks.size()) I.sccValid = false;
+}
+
+void DFnetlist_Impl::noteAddedChannel(channelID c, bool backEdge)
+{
+    IncrementalInfo& I = incremental;
+    if (I.sccValid) {
+        I.newChannels.push_back(c);
+        if (I.newChannels.size() > channels.size()) I.sccValid = false;
+    }
+    if (backEdge) noteBackEdgeChannel(c);
+}
+
+void DFnetlist_Impl::noteAddedBlock(blockID b)
+{
+    IncrementalInfo& I = incremental;
+    if (not I.sccValid) return;
+    I.newBlocks.push_back(b);
+    if (I.newBlocks.size() > blocks.size()) I.sccValid = false;
+}
+
+void DFnetlist_Impl::noteBackEdgeChannel(channelID c)
+{
+    IncrementalInfo& I = incremental;
+    if (not I.backEdgesValid) return;
+    I.backEdgeChannels.push_back(c);
+    if (I.backEdgeChannels.size() > channels.size()) I.backEdgesValid = false;
+}
+
 void DFnetlist_Impl::eraseNonSCC()
 {
     if (SCC.empty()) computeSCC();
@@ -174,8 +459,7 @@ void DFnetlist_Impl::eraseNonSCC()
 
 void DFnetlist_Impl::calculateBackEdges()
 {
-    ForAllChannels(c) {
-
+    auto calculateBackEdge = [this](channelID c) {
         blockID bb = getSrcBlock(c);
         bbID src = getBasicBlock(getSrcBlock(c));
         bbID dst = getBasicBlock(getDstBlock(c));
@@ -183,11 +467,20 @@ void DFnetlist_Impl::calculateBackEdges()
         // If branch goes to its own BB or a BB with a smaller id
         // it is a back edge
         // TODO: determine back edges at CFG level and then apply to CDFG
-        if ((getBlockType(bb) == BRANCH) && src >= dst)
-            setBackEdge(c, true);
-        else
-            setBackEdge(c, false); 
+        channels[c].backEdge = (getBlockType(bb) == BRANCH) && src >= dst;
+    };
+
+    // Only the channels created or modified since the last calculation
+    IncrementalInfo& I = incremental;
+    if (I.backEdgesValid) {
+        for (channelID c: I.backEdgeChannels) {
+            if (validChannel(c)) calculateBackEdge(c);
+        }
+    } else {
+        ForAllChannels(c) calculateBackEdge(c);
     }
+    I.backEdgesValid = true;
+    I.backEdgeChannels.clear();
 
     // Forward traversal starting from entry nodes.
     // DFS();
@@ -34,13 +34,17 @@ double DFnetlist_Impl::extractMarkedGraphsBB(double coverage) {
 
     BBG.calculateBackArcs();
 
+    // The model is built once and updated at every iteration
+    milpVarsCFDFC vars;
+    createMilpCFDFC(freq, vars);
+
     int iter = 1;
     double covered_freq = 0;
     while (covered_freq < coverage * total_freq) {
         cout << "--------------------------" << endl;
         cout << "Iteration " << iter << endl;
 
-        subNetlistBB extracted_CFDFC = extractMarkedGraphBB(freq);
+        subNetlistBB extracted_CFDFC = extractMarkedGraphBB(freq, vars);
 
         if (extracted_CFDFC.empty()){
             cout << "No new MG can be extracted to increase coverage." << endl;
@@ -53,6 +57,10 @@ double DFnetlist_Impl::extractMarkedGraphsBB(double coverage) {
         for (auto arc: extracted_CFDFC.getBasicBlockArcs()) {
             min_freq = min(min_freq, freq[arc]);
         }
+        if (min_freq <= 0) {
+            cout << "The extracted MG does not increase coverage." << endl;
+            break;
+        }
         // update the frequencies of this CFDFC
         for (auto arc: extracted_CFDFC.getBasicBlockArcs())
             freq[arc] -= min_freq;
@@ -118,6 +126,10 @@ double DFnetlist_Impl::extractMarkedGraphs(double coverage)
         // Find the min frequency
         double min_freq = total_freq;  // Never exceed this one
         for (auto b: newMG.getBlocks()) min_freq = min(min_freq, freq[b]);
+        if (min_freq <= 0) {
+            cout << "The extracted MG does not increase coverage." << endl;
+            break;
+        }
 
         // Subtract the frequency from the blocks
         for (auto b: newMG.getBlocks()) freq[b] -= min_freq;
@@ -151,8 +163,8 @@ long long get_timestamp1( void )
 
 // Frequencies must be defined before calling this function.
 // If frequency of an arc is not set or set to zero or less, it will not be included in the MILP.
-DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID, double> &freq) {
-    Milp_Model milp;
+void DFnetlist_Impl::createMilpCFDFC(const map<bbArcID, double> &freq, milpVarsCFDFC& vars) {
+    Milp_Model& milp = vars.milp;
     milp.init(getMilpSolver());
 
     // set the execution frequencies and calculate maximum frequency.
@@ -165,11 +177,16 @@ DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID
         N_e[i] = value;
         N_max = max(N_e[i], N_max);
     }
+    vars.N_max = N_max;
 
-    vector<int> S_BB(BBG.numBasicBlocks() + 1, -1);     // Variables to model BB presence
-    vector<int> S_e(BBG.numArcs(), -1);                 // Variables to model edge presence
-    vector<int> NxS_e(BBG.numArcs(), -1);               // Variables to model N * S_e
-    int N;                                              // Variable to model CFDFC frequency
+    vector<int>& S_BB = vars.S_BB;
+    vector<int>& S_e = vars.S_e;
+    vector<int>& NxS_e = vars.NxS_e;
+
+    S_BB.assign(BBG.numBasicBlocks() + 1, -1);
+    S_e.assign(BBG.numArcs(), -1);
+    NxS_e.assign(BBG.numArcs(), -1);
+    vars.row_N_e.assign(BBG.numArcs(), -1);
 
     // create the variables
     for (bbID i = 1; i <= BBG.numBasicBlocks(); i++){
@@ -182,7 +199,7 @@ DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID
         S_e[i] = milp.newBooleanVar("S_e_" + to_string(i));
         NxS_e[i] = milp.newRealVar("NxS_e" + to_string(i), 0, N_e[i]);
     }
-    N = milp.newIntegerVar("N", 0, N_max);
+    int N = vars.N = milp.newIntegerVar("N", 0, N_max);
 
     vector<int> inVars, outVars;
     for (bbID i = 1; i <= BBG.numBasicBlocks(); i++){
@@ -211,11 +228,8 @@ DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID
         milp.newRow( {{1, NxS_e[i]}, {-N_max, S_e[i]}}, '<', 0);
         milp.newRow( {{1, NxS_e[i]}, {-1, N}, {-N_max, S_e[i]}}, '>', -N_max);
 
-        Milp_Model::vecTerms N_constraint;
-        N_constraint.push_back({N_e[i], S_e[i]});
-        N_constraint.push_back({-1 * N_max, S_e[i]});
-        N_constraint.push_back({-1, N});
-        milp.newRow(N_constraint, '>', -1 * N_max);
+        // N <= N_e + N_max * (1 - S_e). Only the RHS depends on the frequency of the edge.
+        vars.row_N_e[i] = milp.newRow( {{1, N}, {N_max, S_e[i]}}, '<', N_e[i] + N_max);
 
         if (BBG.isBackArc(i)) {
             one_MG_constraint.push_back({1, S_e[i]});
@@ -230,6 +244,31 @@ DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID
     }
     milp.setMaximize();
 
+    // The CFDFC of the previous iteration is a good initial solution
+    milp.setWarmStart();
+}
+
+DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbArcID, double> &freq, milpVarsCFDFC& vars) {
+    Milp_Model& milp = vars.milp;
+    const vector<int>& S_BB = vars.S_BB;
+    const vector<int>& S_e = vars.S_e;
+
+    // Update the model with the residual frequencies.
+    // Edges with no residual frequency are excluded by fixing S_e to 0.
+    double N_max = 0;
+    for (bbArcID i = 0; i < BBG.numArcs(); i++){
+        if (S_e[i] == -1) continue;
+
+        double N_e = 0;
+        if (freq.find(i) != freq.end()) N_e = max((freq.find(i))->second, 0.0);
+        N_max = max(N_e, N_max);
+
+        milp.setBounds(S_e[i], 0, N_e > 0 ? 1 : 0);
+        milp.setBounds(vars.NxS_e[i], 0, N_e);
+        milp.setRHS(vars.row_N_e[i], N_e + vars.N_max);
+    }
+    milp.setBounds(vars.N, 0, N_max);
+
     // run milp and calculate elapsed time
     long long start_time, end_time;
     uint32_t elapsed_time;
@@ -242,8 +281,12 @@ DFnetlist_Impl::subNetlistBB DFnetlist_Impl::extractMarkedGraphBB(const map<bbID
     elapsed_time = ( uint32_t ) ( end_time - start_time ) ;
     printf ("ILP time: [ms] %d \n\r", elapsed_time);
 
-    // add the selected blocks and arcs to the cfdfc.
     subNetlistBB selected;
+    if (milp.getStatus() != Milp_Model::OPTIMAL and milp.getStatus() != Milp_Model::NONOPTIMAL) {
+        return selected;
+    }
+
+    // add the selected blocks and arcs to the cfdfc.
     for (bbID i = 1; i <= BBG.numBasicBlocks(); i++){
         if (S_BB[i] >= 0 and milp.isTrue(S_BB[i])){
             selected.insertBasicBlock(i);
@@ -0,0 +1,184 @@
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <graphviz/cgraph.h>
+#include "DFnetlist.h"
+#include "NetlistBinary.h"
+
+using namespace Dataflow;
+using namespace std;
+
+/*
+ * Conversion between the graphs of graphviz and the binary netlists (see
+ * NetlistBinary.h). The binary files keep the attributes exactly as in the dot
+ * files (the subgraphs used for the layout are not kept), so that the netlist
+ * read from a binary file is the same as the one read from the dot file.
+ */
+
+using AttrList = vector<Agsym_t*>;
+
+// All the attributes of one kind (graph, node or edge) of a graph
+static AttrList graphAttrs(Agraph_t* g, int kind)
+{
+    AttrList attrs;
+    for (Agsym_t* sym = agnxtattr(g, kind, nullptr); sym; sym = agnxtattr(g, kind, sym)) attrs.push_back(sym);
+    return attrs;
+}
+
+// Stores the attributes of an element that differ from their default value
+static void storeAttrs(NetlistBinary::Writer& w, NetlistBinary::Owner owner, int index, void* obj, const AttrList& attrs)
+{
+    for (Agsym_t* sym: attrs) {
+        const char* value = agxget(obj, sym);
+        if (value != nullptr and string(value) != sym->defval) w.setAttr(owner, index, sym->name, value);
+    }
+}
+
+static bool writeGraphBinary(Agraph_t* g, const string& filename, string& error)
+{
+    NetlistBinary::Writer w;
+    w.setGraphName(agnameof(g));
+
+    AttrList graph_attrs = graphAttrs(g, AGRAPH);
+    AttrList node_attrs = graphAttrs(g, AGNODE);
+    AttrList edge_attrs = graphAttrs(g, AGEDGE);
+    for (Agsym_t* sym: graph_attrs) w.declareAttr(NetlistBinary::GRAPH, sym->name, sym->defval);
+    for (Agsym_t* sym: node_attrs) w.declareAttr(NetlistBinary::NODE, sym->name, sym->defval);
+    for (Agsym_t* sym: edge_attrs) w.declareAttr(NetlistBinary::EDGE, sym->name, sym->defval);
+
+    storeAttrs(w, NetlistBinary::GRAPH, 0, g, graph_attrs);
+
+    map<Agnode_t*, int> node_index;
+    for (Agnode_t* v = agfstnode(g); v; v = agnxtnode(g, v)) {
+        int n = w.addNode(agnameof(v));
+        node_index[v] = n;
+        storeAttrs(w, NetlistBinary::NODE, n, v, node_attrs);
+    }
+
+    // Edges in the order they are traversed when reading the graph
+    for (Agnode_t* v = agfstnode(g); v; v = agnxtnode(g, v)) {
+        for (Agedge_t* e = agfstout(g, v); e; e = agnxtout(g, e)) {
+            int i = w.addEdge(node_index[agtail(e)], node_index[aghead(e)]);
+            storeAttrs(w, NetlistBinary::EDGE, i, e, edge_attrs);
+        }
+    }
+
+    return w.write(filename, error);
+}
+
+// Reads a dot file (in memory) as a graph of graphviz
+static Agraph_t* readGraphDot(const string& text, string& error)
+{
+    agseterr(AGMAX);
+    Agraph_t* g = agmemread(text.c_str());
+    if (agerrors() > 0) {
+        error = "Read netlist: " + string(aglasterr());
+        if (g != nullptr) agclose(g);
+        return nullptr;
+    }
+    if (g == nullptr) error = "No graph has been read.";
+    return g;
+}
+
+// Builds the graph of graphviz of a binary file
+static Agraph_t* readGraphBinary(const NetlistBinary::Reader& r)
+{
+    Agraph_t* g = agopen((char*) r.graphName(), Agdirected, nullptr);
+
+    // The attributes are declared with their default value, as when reading the dot file
+    vector<Agsym_t*> syms(r.numColumns());
+    for (int col = 0; col < r.numColumns(); col++) {
+        int kind = r.column(col).owner == NetlistBinary::GRAPH ? AGRAPH :
+                   r.column(col).owner == NetlistBinary::NODE ? AGNODE : AGEDGE;
+        string value = r.column(col).owner == NetlistBinary::GRAPH ? r.getText(col, 0) : r.columnDefault(col);
+        syms[col] = agattr(g, kind, (char*) r.columnKey(col), (char*) r.columnDefault(col));
+        if (kind == AGRAPH) agxset(g, syms[col], (char*) value.c_str());
+    }
+
+    vector<Agnode_t*> nodes(r.numNodes());
+    for (int n = 0; n < r.numNodes(); n++) nodes[n] = agnode(g, (char*) r.nodeName(n), 1);
+
+    for (int col = 0; col < r.numColumns(); col++) {
+        if (r.column(col).owner != NetlistBinary::NODE) continue;
+        for (int n = 0; n < r.numNodes(); n++) {
+            if (r.has(col, n)) agxset(nodes[n], syms[col], (char*) r.getText(col, n).c_str());
+        }
+    }
+
+    vector<Agedge_t*> edges(r.numEdges());
+    for (int e = 0; e < r.numEdges(); e++) {
+        edges[e] = agedge(g, nodes[r.edgeSrc(e)], nodes[r.edgeDst(e)], nullptr, 1);
+    }
+
+    for (int col = 0; col < r.numColumns(); col++) {
+        if (r.column(col).owner != NetlistBinary::EDGE) continue;
+        for (int e = 0; e < r.numEdges(); e++) {
+            if (r.has(col, e)) agxset(edges[e], syms[col], (char*) r.getText(col, e).c_str());
+        }
+    }
+
+    return g;
+}
+
+bool DFnetlist_Impl::writeBinary(const string& filename)
+{
+    ostringstream of;
+    if (not writeDot(of)) return false;
+
+    string error;
+    Agraph_t* g = readGraphDot(of.str(), error);
+    if (g == nullptr) {
+        setError(error);
+        return false;
+    }
+
+    bool status = writeGraphBinary(g, filename, error);
+    agclose(g);
+    if (not status) setError(error);
+    return status;
+}
+
+bool DFnetlist_Impl::readDataflowBinary(const string& filename)
+{
+    NetlistBinary::Reader r;
+    if (not r.open(filename)) {
+        setError(r.getError());
+        return false;
+    }
+
+    Agraph_t* g = readGraphBinary(r);
+    bool status = readDataflowGraph(g);
+    agclose(g);
+    return status;
+}
+
+bool Dataflow::convertDotToBinary(const string& dotfile, const string& binfile, string& error)
+{
+    ifstream f(dotfile);
+    if (not f.good()) {
+        error = "File " + dotfile + " could not be opened.";
+        return false;
+    }
+    ostringstream text;
+    text << f.rdbuf();
+
+    Agraph_t* g = readGraphDot(text.str(), error);
+    if (g == nullptr) return false;
+
+    bool status = writeGraphBinary(g, binfile, error);
+    agclose(g);
+    return status;
+}
+
+bool Dataflow::convertBinaryToDot(const string& binfile, const string& dotfile, string& error)
+{
+    NetlistBinary::Reader r;
+    if (not r.open(binfile)) {
+        error = r.getError();
+        return false;
+    }
+
+    ostringstream of;
+    r.writeDot(of);
+    return FileUtil::write(of.str(), dotfile, error);
+}
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+#include "DFnetlist.h"
+
+using namespace Dataflow;
+using namespace std;
+
+/*
+ * This file contains the buffer cache: a directory with the buffer placement of
+ * the disjoint marked graphs (MGs) solved by addElasticBuffersBB_sc. Every MG is
+ * described by a text with everything its MILP depends on (blocks, ports,
+ * channels, sub MGs, parameters of the model and delay library). The entry of
+ * an MG is the file <dir>/<hash of the description>.txt:
+ *
+ *   key <number of lines of the description>
+ *   <description>
+ *   buffer <TAB> channel <TAB> slots <TAB> transparent <TAB> eb
+ *   retiming <TAB> block <TAB> diff
+ *   throughput <TAB> value
+ *
+ * The description is stored and compared in full, so a hash collision is only a
+ * cache miss. Blocks and channels are referred to by name, since the identifiers
+ * change from one netlist to another.
+ */
+
+// Full precision, so that a cached placement is applied exactly as solved
+static string toText(double x)
+{
+    ostringstream s;
+    s << setprecision(17) << x;
+    return s.str();
+}
+
+// FNV-1a hash of the description, used as file name
+static string hashKey(const string& key)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char ch: key) {
+        h ^= ch;
+        h *= 1099511628211ULL;
+    }
+    char name[17];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long) h);
+    return name;
+}
+
+static string cacheFile(const string& dir, const string& key)
+{
+    return dir + "/" + hashKey(key) + ".txt";
+}
+
+// Contents of a library file (empty if it does not exist)
+static string readFileContents(const string& filename)
+{
+    ifstream f(filename);
+    if (not f.good()) return "";
+    ostringstream s;
+    s << f.rdbuf();
+    return s.str();
+}
+
+string DFnetlist_Impl::describeMilpEB_sc(int mg, double Period, double BufferDelay, bool MaxThroughput, bool first_MG,
+                                         const std::string& model_mode, const std::string& lib_path)
+{
+    const subNetlist& sub = MG_disjoint[mg];
+
+    // The channels of the MG and the ones connected to it (their buffers and
+    // border conditions are also seen by the model), with their blocks
+    setChannels chans;
+    setBlocks blks;
+    ForAllChannels(c) {
+        blockID src = getSrcBlock(c), dst = getDstBlock(c);
+        if (sub.hasChannel(c) or sub.hasBlock(src) or sub.hasBlock(dst)) {
+            chans.insert(c);
+            blks.insert(src);
+            blks.insert(dst);
+        }
+    }
+    for (blockID b: sub.getBlocks()) blks.insert(b);
+
+    vector<string> lines;
+
+    for (blockID b: blks) {
+        ostringstream s;
+        s << "block\t" << getBlockName(b) << '\t' << getBlockType(b) << '\t' << getOperation(b)
+          << '\t' << getBasicBlock(b) << '\t' << getLatency(b) << '\t' << getInitiationInterval(b)
+          << '\t' << sub.hasBlock(b) << '\t' << toText(getBlockDelay(b, -1));
+        for (int i = 0; i < 8; i++) s << ' ' << toText(getBlockDelay(b, i));
+        ForAllPorts(b, p) {
+            s << '\t' << getPortName(p, false) << ' ' << getPortType(p) << ' ' << getPortWidth(p)
+              << ' ' << toText(getPortDelay(p));
+        }
+        lines.push_back(s.str());
+    }
+
+    for (channelID c: chans) {
+        ostringstream s;
+        s << "channel\t" << getChannelName(c) << '\t' << sub.hasChannel(c) << '\t' << getChannelBufferSize(c)
+          << '\t' << isChannelTransparent(c) << '\t' << channelIsInBorders(c) << '\t' << channelIsInMCLSQ(c)
+          << '\t' << isBackEdge(c) << '\t' << toText(getChannelFrequency(c));
+        lines.push_back(s.str());
+    }
+
+    sort(lines.begin(), lines.end());
+
+    // The sub MGs, in the order of the model (the throughput is stored in this order)
+    for (auto sub_mg: components[mg]) {
+        vector<string> names;
+        for (channelID c: MG[sub_mg].getChannels()) names.push_back(getChannelName(c));
+        sort(names.begin(), names.end());
+
+        ostringstream s;
+        s << "mg\t" << toText(MGfreq[sub_mg]) << '\t' << MG[sub_mg].numChannels();
+        for (const string& name: names) s << '\t' << name;
+        lines.push_back(s.str());
+    }
+
+    ostringstream s;
+    s << "params\t" << toText(Period) << '\t' << toText(BufferDelay) << '\t' << MaxThroughput << '\t'
+      << first_MG << '\t' << model_mode << '\t' << getMilpSolver();
+    lines.insert(lines.begin(), s.str());
+
+    // The delay library, for the models that use it
+    if (model_mode.compare("default")) {
+        for (const char* lib: {"valid", "ready", "mixed"}) {
+            istringstream contents(readFileContents(lib_path + "/delays_lib_" + lib + ".txt"));
+            string line;
+            while (getline(contents, line)) lines.push_back("lib_" + string(lib) + '\t' + line);
+        }
+    }
+
+    string key;
+    for (const string& line: lines) key += line + '\n';
+    return key;
+}
+
+bool DFnetlist_Impl::readBufferCache(const std::string& key, int mg, bufferSolutionMG& sol) const
+{
+    ifstream f(cacheFile(getBufferCache(), key));
+    if (not f.good()) return false;
+
+    string line;
+    int nlines;
+    if (not getline(f, line) or sscanf(line.c_str(), "key %d", &nlines) != 1) return false;
+
+    string stored;
+    for (int i = 0; i < nlines; i++) {
+        if (not getline(f, line)) return false;
+        stored += line + '\n';
+    }
+    if (stored != key) return false;
+
+    map<string, channelID> name2channel;
+    for (channelID c: MG_disjoint[mg].getChannels()) name2channel[getChannelName(c)] = c;
+
+    sol = bufferSolutionMG();
+    while (getline(f, line)) {
+        vector<string> fields;
+        istringstream s(line);
+        string field;
+        while (getline(s, field, '\t')) fields.push_back(field);
+
+        if (fields.size() == 5 and fields[0] == "buffer") {
+            auto it = name2channel.find(fields[1]);
+            if (it == name2channel.end()) return false;
+            bufferSolutionMG::buffer buf;
+            buf.c = it->second;
+            buf.slots = stoi(fields[2]);
+            buf.transparent = fields[3] == "1";
+            buf.eb = fields[4] == "1";
+            sol.buffers.push_back(buf);
+        } else if (fields.size() == 3 and fields[0] == "retiming") {
+            blockID b = getBlock(fields[1]);
+            if (not validBlock(b)) return false;
+            sol.retiming.push_back(make_pair(b, stod(fields[2])));
+        } else if (fields.size() == 2 and fields[0] == "throughput") {
+            sol.throughput.push_back(stod(fields[1]));
+        } else return false;
+    }
+
+    return true;
+}
+
+bool DFnetlist_Impl::writeBufferCache(const std::string& key, const bufferSolutionMG& sol) const
+{
+    const string& dir = getBufferCache();
+    mkdir(dir.c_str(), 0755);
+
+    ostringstream s;
+    s << "key " << count(key.begin(), key.end(), '\n') << '\n' << key;
+    for (const auto& buf: sol.buffers) {
+        s << "buffer\t" << getChannelName(buf.c) << '\t' << buf.slots << '\t' << buf.transparent << '\t' << buf.eb << '\n';
+    }
+    for (const auto& ret: sol.retiming) {
+        s << "retiming\t" << getBlockName(ret.first) << '\t' << toText(ret.second) << '\n';
+    }
+    for (double th: sol.throughput) s << "throughput\t" << toText(th) << '\n';
+
+    // Written in a temporary file and renamed, so that concurrent runs never see partial entries
+    string tmp = FileUtil::createTempFilename(dir + "/entry");
+    if (tmp.empty()) return false;
+
+    string error;
+    if (not FileUtil::write(s.str(), tmp, error) or rename(tmp.c_str(), cacheFile(dir, key).c_str()) != 0) {
+        FileUtil::deleteTempFilename(tmp);
+        return false;
+    }
+    return true;
+}
@@ -4,6 +4,9 @@
 #include <iostream>
 #include <regex>
 #include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include "DFnetlist.h"
 
 using namespace Dataflow;
@@ -137,11 +140,11 @@ void DFnetlist_Impl::reduceMerges(){ //Carmine 09.03.22 function to eliminate th
 
 void DFnetlist_Impl::createMilpVarsEB(Milp_Model& milp, milpVarsEB& vars, bool max_throughput, bool first_MG)
 {
-    vars.buffer_flop = vector<int>(vecChannelsSize(), -1);
-    vars.buffer_slots = vector<int>(vecChannelsSize(), -1);
-    vars.has_buffer = vector<int>(vecChannelsSize(), -1);
-    vars.time_path = vector<int>(vecPortsSize(), -1);
-    vars.time_elastic = vector<int>(vecPortsSize(), -1);
+    vars.buffer_flop.clear();
+    vars.buffer_slots.clear();
+    vars.has_buffer.clear();
+    vars.time_path.clear();
+    vars.time_elastic.clear();
 
     ForAllChannels(c) {
         if (channelIsCovered(c, false, true, false)) continue;
@@ -168,11 +171,11 @@ void DFnetlist_Impl::createMilpVarsEB(Milp_Model& milp, milpVarsEB& vars, bool m
     if (not max_throughput) return;
 
     // Variables to model throughput
-    vars.in_retime_tokens = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.out_retime_tokens = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.th_tokens = vector<vector<int>>(MG.size(), vector<int> (vecChannelsSize(), -1));
-    vars.retime_bubbles = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.th_bubbles = vector<vector<int>>(MG.size(), vector<int> (vecChannelsSize(), -1));
+    vars.in_retime_tokens = vector<milpVarMap>(MG.size());
+    vars.out_retime_tokens = vector<milpVarMap>(MG.size());
+    vars.th_tokens = vector<milpVarMap>(MG.size());
+    vars.retime_bubbles = vector<milpVarMap>(MG.size());
+    vars.th_bubbles = vector<milpVarMap>(MG.size());
     vars.th_MG = vector<int>(MG.size(), -1);
     for (int mg = 0; mg < MG.size(); ++mg) {
 
@@ -201,18 +204,39 @@ void DFnetlist_Impl::createMilpVarsEB(Milp_Model& milp, milpVarsEB& vars, bool m
 }
 
 void DFnetlist_Impl::createMilpVarsEB_sc(Milp_Model &milp, milpVarsEB &vars, bool max_throughput, int mg, bool first_MG, string model_mode) {
-    vars.buffer_flop = vector<int>(vecChannelsSize(), -1);
-    vars.buffer_flop_valid = vector<int>(vecChannelsSize(), -1); //Carmine 17.02.22
-    vars.buffer_flop_ready = vector<int>(vecChannelsSize(), -1); //Carmine 17.02.22
-    vars.buffer_slots = vector<int>(vecChannelsSize(), -1);
-    vars.has_buffer = vector<int>(vecChannelsSize(), -1);
-    vars.time_path = vector<int>(vecPortsSize(), -1);
-    vars.time_valid_path = vector<int>(vecPortsSize(), -1); //Carmine 16.02.22
-    vars.time_ready_path = vector<int>(vecPortsSize(), -1); //Carmine 17.02.22
-    vars.time_elastic = vector<int>(vecPortsSize(), -1);
+    vars.buffer_flop.clear();
+    vars.buffer_flop_valid.clear(); //Carmine 17.02.22
+    vars.buffer_flop_ready.clear(); //Carmine 17.02.22
+    vars.buffer_slots.clear();
+    vars.has_buffer.clear();
+    vars.time_path.clear();
+    vars.time_valid_path.clear(); //Carmine 16.02.22
+    vars.time_ready_path.clear(); //Carmine 17.02.22
+    vars.time_elastic.clear();
 
     const string& mg_name = "_mg" + to_string(mg);
 
+    // The channels and blocks of the borders connected to the MG, found from the
+    // ports of the MG, so that the constraints only visit the MG and its borders
+    setChannels border_channels;
+    setBlocks border_blocks;
+    for (blockID b: MG_disjoint[mg].getBlocks()) {
+        ForAllPorts(b,p) {
+            if (not isPortConnected(p)) continue;
+            channelID c = getConnectedChannel(p);
+            blockID other = isInputPort(p) ? getSrcBlock(c) : getDstBlock(c);
+            if (channelIsInBorders(c)) border_channels.insert(c);
+            if (blockIsInBorders(other)) border_blocks.insert(other);
+        }
+    }
+    vars.border_channels.assign(border_channels.begin(), border_channels.end());
+    vars.border_blocks.assign(border_blocks.begin(), border_blocks.end());
+
+    // Variables for the ports of the MG and the ports of the borders connected to it
+    int num_ports = 2 * (MG_disjoint[mg].numChannels() + border_channels.size());
+    vars.time_path.reserve(num_ports);
+    vars.time_elastic.reserve(num_ports);
+
     ///////////////////////
     /// CHANNELS IN MG  ///
     ///////////////////////
@@ -265,7 +289,7 @@ void DFnetlist_Impl::createMilpVarsEB_sc(Milp_Model &milp, milpVarsEB &vars, boo
     ///////////////////////////
     /// BLOCKS IN MG BORDER ///
     ///////////////////////////
-    for (blockID b: blocks_in_borders) {
+    for (blockID b: vars.border_blocks) {
         const string& bname = getBlockName(b);
         ForAllPorts(b,p) {
             portID other_p;
@@ -317,11 +341,11 @@ void DFnetlist_Impl::createMilpVarsEB_sc(Milp_Model &milp, milpVarsEB &vars, boo
     if (not max_throughput) return;
 
     // Variables to model throughput
-    vars.in_retime_tokens = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.out_retime_tokens = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.th_tokens = vector<vector<int>>(MG.size(), vector<int> (vecChannelsSize(), -1));
-    vars.retime_bubbles = vector<vector<int>>(MG.size(), vector<int> (vecBlocksSize(), -1));
-    vars.th_bubbles = vector<vector<int>>(MG.size(), vector<int> (vecChannelsSize(), -1));
+    vars.in_retime_tokens = vector<milpVarMap>(MG.size());
+    vars.out_retime_tokens = vector<milpVarMap>(MG.size());
+    vars.th_tokens = vector<milpVarMap>(MG.size());
+    vars.retime_bubbles = vector<milpVarMap>(MG.size());
+    vars.th_bubbles = vector<milpVarMap>(MG.size());
     vars.th_MG = vector<int>(MG.size(), -1);
 
     for (auto sub_mg: components[mg]) {
@@ -356,15 +380,15 @@ void DFnetlist_Impl::createMilpVarsEB_sc(Milp_Model &milp, milpVarsEB &vars, boo
 }
 
 void DFnetlist_Impl::createMilpVars_remaining(Milp_Model &milp, milpVarsEB &vars, string model_mode) {
-    vars.buffer_flop = vector<int>(vecChannelsSize(), -1);
-    vars.buffer_flop_valid = vector<int>(vecChannelsSize(), -1); //Carmine 18.02.22
-    vars.buffer_flop_ready = vector<int>(vecChannelsSize(), -1); //Carmine 18.02.22
-    vars.has_buffer = vector<int>(vecChannelsSize(), -1); //Carmine 18.02.22 since the remaining channels are considered only for CP the presence of a transparent buffer is in general ignored
+    vars.buffer_flop.clear();
+    vars.buffer_flop_valid.clear(); //Carmine 18.02.22
+    vars.buffer_flop_ready.clear(); //Carmine 18.02.22
+    vars.has_buffer.clear(); //Carmine 18.02.22 since the remaining channels are considered only for CP the presence of a transparent buffer is in general ignored
                                                             //this variable is necessary to include this case scenario
-    vars.time_path = vector<int>(vecPortsSize(), -1);
-    vars.time_valid_path = vector<int>(vecPortsSize(), -1); //Carmine 18.02.22
-    vars.time_ready_path = vector<int>(vecPortsSize(), -1); //Carmine 18.02.22
-    vars.time_elastic = vector<int>(vecPortsSize(), -1);
+    vars.time_path.clear();
+    vars.time_valid_path.clear(); //Carmine 18.02.22
+    vars.time_ready_path.clear(); //Carmine 18.02.22
+    vars.time_elastic.clear();
 
     ForAllChannels(c) {
         if (channelIsCovered(c, true, true, false))
@@ -633,9 +657,79 @@ bool DFnetlist_Impl::addElasticBuffersBB(double Period, double BufferDelay, bool
     return true;
 }
 
+bool DFnetlist_Impl::solveMilpEB_sc(milpResultMG& res, int mg, double Period, double BufferDelay, bool MaxThroughput,
+                                    int timeout, bool first_MG, const std::string& model_mode, const std::string& lib_path) {
+
+    Milp_Model& milp = res.milp;
+    milpVarsEB& vars = res.vars;
+    double order_buf = 0.0001, order_slot = 0.00001;
+
+    if (not milp.init(getMilpSolver())) {
+        setError(milp.getError());
+        return false;
+    }
+
+    long long start_time = get_timestamp();
+
+    createMilpVarsEB_sc(milp, vars, MaxThroughput, mg, first_MG, model_mode);
+    if (not createPathConstraints_sc(milp, vars, Period, BufferDelay, mg)) return false;
+    if (model_mode.compare("default")){ //Carmine 16.02.22 additional model_mode to have different working principle
+        if (not createPathConstraintsOthers_sc(milp, vars, Period, BufferDelay, mg, model_mode, lib_path)){
+            cout << "*ERROR* creating path constraint for non-data signals" << endl;
+            return false;
+        }else
+            cout << "*INFO* MILP mode executed: " << model_mode << endl;
+    }
+    if (not createElasticityConstraints_sc(milp, vars, mg)) return false;
+
+    double highest_coef = 1.0;
+    if (MaxThroughput) {
+        createThroughputConstraints_sc(milp, vars, mg, first_MG);
+
+        double total_freq = 0;
+        for (channelID c: MG_disjoint[mg].getChannels()) {
+            total_freq += getChannelFrequency(c);
+        }
+
+        double mg_highest_coef = 0.0;
+        for (auto sub_mg: components[mg]) {
+            double coef = MG[sub_mg].numChannels() * MGfreq[sub_mg] / total_freq;
+            milp.newCostTerm(coef, vars.th_MG[sub_mg]);
+            mg_highest_coef = mg_highest_coef > coef ? mg_highest_coef : coef;
+            if (first_MG) break;
+        }
+        highest_coef = mg_highest_coef;
+    }
+
+    for (channelID c: MG_disjoint[mg].getChannels()) {
+        if (channelIsCovered(c, false, true, false)) continue;
+
+        milp.newCostTerm(-1 * order_buf * highest_coef, vars.has_buffer[c]);
+        milp.newCostTerm(-1 * order_slot * highest_coef, vars.buffer_slots[c]);
+    }
+
+    milp.setMaximize();
+    res.build_time = get_timestamp() - start_time;
+
+    cout << "Solving MILP for elastic buffers: MG " << mg << endl;
+
+    start_time = get_timestamp();
+    if (timeout > 0) milp.solve(timeout);
+    else milp.solve();
+    res.solve_time = get_timestamp() - start_time;
+
+    Milp_Model::Status stat = milp.getStatus();
+    if (stat != Milp_Model::OPTIMAL and stat != Milp_Model::NONOPTIMAL) {
+        setError("No solution found to add elastic buffers (MG " + to_string(mg) + ").");
+        return false;
+    }
+    return true;
+}
+
 bool DFnetlist_Impl::addElasticBuffersBB_sc(double Period, double BufferDelay, bool MaxThroughput, double coverage, int timeout, bool first_MG, const std::string& model_mode,const std::string& lib_path) {
 
     cleanElasticBuffers();
+    MGthroughput.clear();
 
     cout << "======================" << endl;
     cout << "ADDING ELASTIC BUFFERS" << endl;
@@ -690,141 +784,134 @@ bool DFnetlist_Impl::addElasticBuffersBB_sc(double Period, double BufferDelay, b
     calculateDisjointCFDFCs();
     makeMGsfromCFDFCs();
 
-    auto milpVars_sc = vector<milpVarsEB>(MG_disjoint.size(), milpVarsEB());
     long long total_time = 0;
-    double order_buf = 0.0001, order_slot = 0.00001;
 
     float min_th_mg = 1.1; //Carmine 28.02.22 lowest throughput among MGs
 
     if (MaxThroughput) computeChannelFrequencies();
 
-    for (int i = 0; i < MG_disjoint.size(); i++) {
-        cout << "-------------------------------" << endl;
-        cout << "Initiating MILP for MG number " << i << endl;
-        cout << "-------------------------------" << endl;
+    // The disjoint MGs are independent: their models are built and solved by a pool
+    // of workers and the solutions are applied afterwards in the order of the MGs.
+    int num_MG = MG_disjoint.size();
+    vector<milpResultMG> milp_sc(num_MG);
+    atomic<int> next_mg(0);
 
-        createMilpVarsEB_sc(milp, milpVars_sc[i], MaxThroughput, i, first_MG, model_mode);
-        if (not createPathConstraints_sc(milp, milpVars_sc[i], Period, BufferDelay, i)) return false;
-        if (model_mode.compare("default")){ //Carmine 16.02.22 additional model_mode to have different working principle
-            if (not createPathConstraintsOthers_sc(milp, milpVars_sc[i], Period, BufferDelay, i, model_mode, lib_path)){ 
-                cout << "*ERROR* creating path constraint for non-data signals" << endl;
-                return false;
-            }else
-                cout << "*INFO* MILP mode executed: " << model_mode << endl;
+    // MGs whose description is in the buffer cache reuse the stored placement
+    int num_cached = 0;
+    if (not getBufferCache().empty()) {
+        for (int i = 0; i < num_MG; i++) {
+            milp_sc[i].cache_key = describeMilpEB_sc(i, Period, BufferDelay, MaxThroughput, first_MG, model_mode, lib_path);
+            milp_sc[i].cached = readBufferCache(milp_sc[i].cache_key, i, milp_sc[i].solution);
+            if (milp_sc[i].cached) num_cached++;
         }
-        if (not createElasticityConstraints_sc(milp, milpVars_sc[i], i)) return false;
-
-
-        double highest_coef = 1.0;
-        if (MaxThroughput) {
-            createThroughputConstraints_sc(milp, milpVars_sc[i], i, first_MG);
-
-            double total_freq = 0;
-            for (channelID c: MG_disjoint[i].getChannels()) {
-                total_freq += getChannelFrequency(c);
-            }
+        cout << "Buffer cache " << getBufferCache() << ": " << num_cached << " of " << num_MG << " MGs found" << endl;
+    }
 
-            double mg_highest_coef = 0.0;
-            for (auto sub_mg: components[i]) {
-                double coef = MG[sub_mg].numChannels() * MGfreq[sub_mg] / total_freq;
-                milp.newCostTerm(coef, milpVars_sc[i].th_MG[sub_mg]);
-                mg_highest_coef = mg_highest_coef > coef ? mg_highest_coef : coef;
-                if (first_MG) break;
+    auto milp_worker = [&]() {
+        for (int i = next_mg++; i < num_MG; i = next_mg++) {
+            if (milp_sc[i].cached) {
+                milp_sc[i].solved = true;
+                continue;
             }
-            highest_coef = mg_highest_coef;
-        }
-
-        for (channelID c: MG_disjoint[i].getChannels()) {
-            if (channelIsCovered(c, false, true, false)) continue;
-
-            milp.newCostTerm(-1 * order_buf * highest_coef, milpVars_sc[i].has_buffer[c]);
-            milp.newCostTerm(-1 * order_slot * highest_coef, milpVars_sc[i].buffer_slots[c]);
-        }
-
-        milp.setMaximize();
-
-        cout << "Solving MILP for elastic buffers: MG " << i << endl;
-
-        long long start_time, end_time;
-        uint32_t elapsed_time;
-        start_time = get_timestamp();
-        if (timeout > 0) milp.solve(timeout);
-        else milp.solve();
-        end_time = get_timestamp();
-        elapsed_time = ( uint32_t ) ( end_time - start_time ) ;
-        printf ("Milp time for MG %d: [ms] %d \n\n\r", i, elapsed_time);
-        total_time += elapsed_time;
-
-        Milp_Model::Status stat = milp.getStatus();
-        if (stat != Milp_Model::OPTIMAL and stat != Milp_Model::NONOPTIMAL) {
-            setError("No solution found to add elastic buffers.");
+            redirectThreadErrors(&milp_sc[i].error);
+            milp_sc[i].solved = solveMilpEB_sc(milp_sc[i], i, Period, BufferDelay, MaxThroughput,
+                                               timeout, first_MG, model_mode, lib_path);
+            redirectThreadErrors(nullptr);
+        }
+    };
+
+    int num_threads = min(getMilpThreads(), num_MG - num_cached);
+    long long start_pool = get_timestamp();
+    if (num_threads <= 1) milp_worker();
+    else {
+        cout << "Solving " << num_MG - num_cached << " MILPs with " << num_threads << " threads" << endl;
+        vector<thread> pool;
+        for (int t = 0; t < num_threads; ++t) pool.emplace_back(milp_worker);
+        for (thread& t: pool) t.join();
+    }
+    total_time = get_timestamp() - start_pool;
+
+    for (int i = 0; i < num_MG; i++) {
+        Milp_Model& milp = milp_sc[i].milp;
+        milpVarsEB& vars = milp_sc[i].vars;
+        bool cached = milp_sc[i].cached;
+
+        if (not milp_sc[i].solved) {
+            setError(milp_sc[i].error.get());
             return false;
         }
 
+        cout << "-------------------------------" << endl;
+        cout << "MILP solution for MG number " << i << (cached ? " (cached)" : "") << endl;
+        cout << "-------------------------------" << endl;
 
-        if (MaxThroughput) {
-            for (auto sub_mg: components[i]) {
-                cout << "************************" << endl;
-                cout << "*** Throughput for MG " << sub_mg << " in disjoint MG " << i << ": ";
-                cout << fixed << setprecision(2) << milp[milpVars_sc[i].th_MG[sub_mg]] << " ***" << endl;
-                cout << "************************" << endl;
-                if (first_MG) break;
-            }
+        if (not cached) getBufferSolutionMG(milp_sc[i], i, MaxThroughput, first_MG, model_mode);
+        const bufferSolutionMG& sol = milp_sc[i].solution;
+
+        for (int k = 0; k < sol.throughput.size(); k++) {
+            cout << "************************" << endl;
+            cout << "*** Throughput for MG " << components[i][k] << " in disjoint MG " << i << ": ";
+            cout << fixed << setprecision(2) << sol.throughput[k] << " ***" << endl;
+            cout << "************************" << endl;
         }
 
-        dumpMilpSolution(milp, milpVars_sc[i]);
+        if (not cached) dumpMilpSolution(milp, vars);
 
         // Add channels
-        vector<channelID> buffers;
-        for (channelID c: MG_disjoint[i].getChannels()) {
-            if (channelIsCovered(c, false, true, true)) continue;
-            if (milp[milpVars_sc[i].buffer_slots[c]] > 0.5) {
-                buffers.push_back(c);
-            }
-        }
-
-        for (channelID c: buffers) {
-            int slots = milp[milpVars_sc[i].buffer_slots[c]] + 0.5; // Automatically truncated
-            bool transparent = milp.isFalse(milpVars_sc[i].buffer_flop[c]);
-            setChannelTransparency(c, transparent);
-            setChannelBufferSize(c, slots);
+        for (const auto& buf: sol.buffers) {
+            channelID c = buf.c;
+            setChannelTransparency(c, buf.transparent);
+            setChannelBufferSize(c, buf.slots);
 
             bool print_reduced=false; //Carmine 25.03.22 variable to manage printing following the createChannel function //give a look to function for doubts
-            if(model_mode.compare("ready")==0 || model_mode.compare("all")==0 || model_mode.compare("mixed")==0){
-                if(!transparent && milp.isTrue(milpVars_sc[i].buffer_flop_ready[c]) ){
-                    setChannelEB(c);
-                    printChannelInfo(c, slots-1, 1);
-                    print_reduced = true;//Carmine 25.03.22
-                }
+            if (buf.eb) {
+                setChannelEB(c);
+                printChannelInfo(c, buf.slots-1, 1);
+                print_reduced = true;//Carmine 25.03.22
             }
             if(print_reduced)
-                printChannelInfo(c, 1, transparent);
+                printChannelInfo(c, 1, buf.transparent);
             else
-                printChannelInfo(c, slots, transparent);
+                printChannelInfo(c, buf.slots, buf.transparent);
         }
 
         //write retiming diffs
-        writeRetimingDiffs(milp, milpVars_sc[i]);
-
+        for (const auto& ret: sol.retiming) setBlockRetimingDiff(ret.first, ret.second);
 
-        if (MaxThroughput) {
-            for (auto sub_mg: components[i]) {
-                cout << "\n*** Throughput achieved in sub MG " << sub_mg << ": " <<
-                     fixed << setprecision(2) << milp[milpVars_sc[i].th_MG[sub_mg]] << " ***\n" << endl;
-                double th_MG_i = milp[milpVars_sc[i].th_MG[sub_mg]];
-                if(th_MG_i < min_th_mg) min_th_mg = th_MG_i; //Carmine 28.02.22 keeping track of the throughput of each MG
-                if (first_MG) break;
-            }
+        for (int k = 0; k < sol.throughput.size(); k++) {
+            int sub_mg = components[i][k];
+            cout << "\n*** Throughput achieved in sub MG " << sub_mg << ": " <<
+                 fixed << setprecision(2) << sol.throughput[k] << " ***\n" << endl;
+            double th_MG_i = sol.throughput[k];
+            MGthroughput[sub_mg] = th_MG_i;
+            if(th_MG_i < min_th_mg) min_th_mg = th_MG_i; //Carmine 28.02.22 keeping track of the throughput of each MG
         }
 
-        milp.writeOutDelays("delays_output.txt"); //Carmine 07.02.22 trying to get from milp the timing output of the blocks
+        if (cached) continue;
 
-        if (not milp.init(getMilpSolver())) {
-            setError(milp.getError());
-            return false;
+        if (getWriteDelays()) milp.writeOutDelays("delays_output.txt"); //Carmine 07.02.22 trying to get from milp the timing output of the blocks
+
+        // Only optimal placements are reused (a timeout may give a worse one)
+        if (not getBufferCache().empty() and milp.getStatus() == Milp_Model::OPTIMAL) {
+            if (not writeBufferCache(milp_sc[i].cache_key, sol))
+                cout << "*WARNING* could not write MG " << i << " in the buffer cache" << endl;
         }
     }
 
+    cout << "-------------------------------------------------" << endl;
+    cout << "MILP time per MG [ms] (" << num_threads << " thread" << (num_threads > 1 ? "s" : "") << ")" << endl;
+    cout << setw(6) << "MG" << setw(10) << "vars" << setw(10) << "rows" << setw(10) << "build" << setw(10) << "solve" << endl;
+    for (int i = 0; i < num_MG; i++) {
+        const milpResultMG& res = milp_sc[i];
+        cout << setw(6) << i;
+        if (res.cached) cout << setw(40) << "cached" << endl;
+        else cout << setw(10) << res.milp.numVariables() << setw(10) << res.milp.numConstraints()
+                  << setw(10) << res.build_time << setw(10) << res.solve_time << endl;
+    }
+    cout << "Wall time for all MGs: [ms] " << total_time << endl;
+    cout << "-------------------------------------------------" << endl;
+    milp_sc.clear();
+
     
     if(min_th_mg <= 1.0)
         cout << "\n*** Lowest throughput achieved " << min_th_mg  << " ***\n" << endl; //Carmine 28.02.22 it shows the lowest throughput among MGs
@@ -1076,8 +1163,7 @@ bool DFnetlist_Impl::createPathConstraints_sc(Milp_Model &milp, milpVarsEB &Vars
     //////////////////////////////
 
     //cout << "   path constraints for channels in MG borders" << endl;
-    for (channelID c: channels_in_borders) {
-        if (!MG_disjoint[mg].hasBlock(getSrcBlock(c)) && !MG_disjoint[mg].hasBlock(getDstBlock(c))) continue;
+    for (channelID c: Vars.border_channels) {
 
         int v1 = Vars.time_path[getSrcPort(c)];
         int v2 = Vars.time_path[getDstPort(c)];
@@ -1181,7 +1267,7 @@ bool DFnetlist_Impl::createPathConstraints_sc(Milp_Model &milp, milpVarsEB &Vars
     /// BLOCKS IN MG BORDERS ///
     ////////////////////////////
     //cout << "   path constraints for blocks in MG border" << endl;
-    for (blockID b: blocks_in_borders) {
+    for (blockID b: Vars.border_blocks) {
         double d = getBlockDelay(b, -1);
 
         // First: combinational blocks
@@ -1242,9 +1328,18 @@ bool DFnetlist_Impl::createPathConstraints_sc(Milp_Model &milp, milpVarsEB &Vars
 }
 
 //Carmine 18.02.22 function to read block delays from library
-vector< pair<string, vector<double>>> DFnetlist_Impl::read_lib_file(string lib_file_path){
+//The libraries are read once per process and shared by all the models (and threads) that use them
+const vector< pair<string, vector<double>>>& DFnetlist_Impl::read_lib_file(string lib_file_path){
+
+    static map<string, vector< pair<string, vector<double>>>> libraries;
+    static mutex libraries_mutex;
+    lock_guard<mutex> lock(libraries_mutex);
+
+    auto lib = libraries.find(lib_file_path);
+    if (lib != libraries.end()) return lib->second;
 
-    vector< pair<string, vector<double>>> output = vector< pair<string, vector<double>>>(30);
+    vector< pair<string, vector<double>>>& output = libraries[lib_file_path];
+    output = vector< pair<string, vector<double>>>(30);
     vector<double> delays =  vector< double>(7); //vector containing delays for 7 different bitwidths
     //for now it is assumed a large number of types although the actual number depends on number of operators
 
@@ -1312,7 +1407,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
     bool hasPeriod = Period > 0;
     if (not hasPeriod) Period = INFINITY;
 
-    vector<int> time_paths, ob_presence;
+    const milpVarMap *time_paths = nullptr, *ob_presence = nullptr;
     vector<string> modes;
     vector< pair<string, vector<double>>> block_delays = vector< pair<string, vector<double>>>(30);
 
@@ -1325,18 +1420,22 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
         modes = {"valid", "ready"};
     else
         modes = {model_mode};
+
+    //the buffers delays are included only if the model mode is ALL or MIXED
+    //(local copy: the models of the disjoint MGs may be built concurrently)
+    bool include_buff_delays = ::include_buff_delays & (  (model_mode.compare("mixed")==0) | (model_mode.compare("all")==0)  );
     
 //Andrea 20220727 delay readed in the dot
     
      for(string mode: modes){
          if(mode.compare("valid") == 0){
-             time_paths = Vars.time_valid_path;
-             ob_presence = Vars.buffer_flop_valid;
+             time_paths = &Vars.time_valid_path;
+             ob_presence = &Vars.buffer_flop_valid;
              if(FPL_22_CARMINE_LIB)
                  block_delays = read_lib_file(lib_path+"/delays_lib_valid.txt");
          }else if(mode.compare("ready") == 0){
-             time_paths = Vars.time_ready_path;
-             ob_presence = Vars.buffer_flop_ready;
+             time_paths = &Vars.time_ready_path;
+             ob_presence = &Vars.buffer_flop_ready;
              if(FPL_22_CARMINE_LIB)
                  block_delays = read_lib_file(lib_path+"/delays_lib_ready.txt");
          }else if(mode.compare("mixed") == 0){
@@ -1358,9 +1457,6 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
             delay_TEHB = 0.1;
             delay_OEHB = 0.1;
         }
-        //the buffers delays are included only if the model mode is ALL or MIXED
-        include_buff_delays = include_buff_delays & (  (model_mode.compare("mixed")==0) | (model_mode.compare("all")==0)  );
-
         //////////////////////
         /** CHANNELS IN MG **/
         //////////////////////
@@ -1373,8 +1469,8 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                 continue;
 
 
-            int v1 =  time_paths[getSrcPort(c)]; //modified
-            int v2 =  time_paths[getDstPort(c)]; //modified
+            int v1 =  (*time_paths)[getSrcPort(c)]; //modified
+            int v2 =  (*time_paths)[getDstPort(c)]; //modified
 
             if(mode.compare("ready") == 0){ //Carmine 17.02.22 // the ready signal direction is opposite to the one of valid
                 int tmp = v1;
@@ -1383,7 +1479,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
             }
 
 
-            int R = ob_presence[c];
+            int R = (*ob_presence)[c];
 
 
             if (hasPeriod) {
@@ -1415,14 +1511,14 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
 
             //Carmine 17.02.22 //the presence of a buffer has to be consistent among different timing domains
             if(mode.compare("valid") == 0){
-                milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,ob_presence[c]}}, '=', 0);
+                milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,(*ob_presence)[c]}}, '=', 0);
             }else if(mode.compare("ready") == 0){
-                //milp.newRow( {{1,Vars.has_buffer[c]}, {-1,Vars.buffer_flop[c]}, {-1,ob_presence[c]}}, '>', 0);
-                //milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,ob_presence[c]}}, '>', 0); //Carmine 18.02.22 if there is a transparent buffer the size must be at least 1
-                milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,ob_presence[c]}, {-1,Vars.buffer_flop[c]}}, '>', 0); //Carmine 25.03.22 since the slots are connected to throughput, thoughput constraints need to know about the possibility of having an additional register (OEHB+TEHB)
+                //milp.newRow( {{1,Vars.has_buffer[c]}, {-1,Vars.buffer_flop[c]}, {-1,(*ob_presence)[c]}}, '>', 0);
+                //milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,(*ob_presence)[c]}}, '>', 0); //Carmine 18.02.22 if there is a transparent buffer the size must be at least 1
+                milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,(*ob_presence)[c]}, {-1,Vars.buffer_flop[c]}}, '>', 0); //Carmine 25.03.22 since the slots are connected to throughput, thoughput constraints need to know about the possibility of having an additional register (OEHB+TEHB)
                 if ((getBlockType(getSrcBlock(c)) == MUX)     //Carmine 21.02.22 MILP should be aware of presence of transparent buffers in MUX and MERGE
                 || (getBlockType(getSrcBlock(c)) == MERGE && getPorts(getSrcBlock(c), INPUT_PORTS).size() > 1)) {
-                    milp.newRow( {{1,ob_presence[c]}}, '>', 1);  //MILP needs to distinguish between the 3 cases transp, nontransp and EB
+                    milp.newRow( {{1,(*ob_presence)[c]}}, '>', 1);  //MILP needs to distinguish between the 3 cases transp, nontransp and EB
                 }
 
             }else{
@@ -1435,11 +1531,10 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
         /// CHANNELS IN MG BORDERS ///
         //////////////////////////////
 
-        for (channelID c: channels_in_borders) {
-            if (!MG_disjoint[mg].hasBlock(getSrcBlock(c)) && !MG_disjoint[mg].hasBlock(getDstBlock(c))) continue;
+        for (channelID c: Vars.border_channels) {
 
-            int v1 = time_paths[getSrcPort(c)]; //modified
-            int v2 = time_paths[getDstPort(c)]; //modified
+            int v1 = (*time_paths)[getSrcPort(c)]; //modified
+            int v2 = (*time_paths)[getDstPort(c)]; //modified
 
             if(mode.compare("ready") == 0){ //Carmine 17.02.22 // the ready signal direction is opposite to the one of valid
                 int tmp = v1;
@@ -1482,14 +1577,14 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
 
             //Carmine 17.02.22 //the presence of a buffer has to be consistent among different timing domains
             if(mode.compare("valid") == 0){
-                milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,ob_presence[c]}}, '=', 0);
+                milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,(*ob_presence)[c]}}, '=', 0);
             }else if(mode.compare("ready") == 0){
-                //milp.newRow( {{1,Vars.has_buffer[c]}, {-1,Vars.buffer_flop[c]}, {-1,ob_presence[c]}}, '>', 0);
-                milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,ob_presence[c]}}, '>', 0); //Carmine 18.02.22 if there is a transparent buffer the size must be at least 1
+                //milp.newRow( {{1,Vars.has_buffer[c]}, {-1,Vars.buffer_flop[c]}, {-1,(*ob_presence)[c]}}, '>', 0);
+                milp.newRow( {{1,Vars.buffer_slots[c]}, {-1,(*ob_presence)[c]}}, '>', 0); //Carmine 18.02.22 if there is a transparent buffer the size must be at least 1
             
                 if ((getBlockType(getSrcBlock(c)) == MUX)     //Carmine 21.02.22 MILP should be aware of presence of transparent buffers in MUX and MERGE
                 || (getBlockType(getSrcBlock(c)) == MERGE && getPorts(getSrcBlock(c), INPUT_PORTS).size() > 1)) {
-                    milp.newRow( {{1,ob_presence[c]}}, '>', 1);  //MILP needs to distinguish between the 3 cases transp, nontransp and EB
+                    milp.newRow( {{1,(*ob_presence)[c]}}, '>', 1);  //MILP needs to distinguish between the 3 cases transp, nontransp and EB
                 }
             
             }else{
@@ -1557,13 +1652,13 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                     if (!MG_disjoint[mg].hasChannel(getConnectedChannel(out_p)))
                         continue;
 
-                    int v_out = time_paths[out_p];
+                    int v_out = (*time_paths)[out_p];
 
                     ForAllInputPorts(b, in_p) {
                         if (!MG_disjoint[mg].hasChannel(getConnectedChannel(in_p)))
                             continue;
 
-                        int v_in = time_paths[in_p];
+                        int v_in = (*time_paths)[in_p];
                         //Carmine 24.03.22 this set of equations is inclued in the channel delays
                         /*double delayBlock_data; //Carmine 22.03.22 necessary to compute the delay on data path for constraints with buffers
                         if(getLatency(b)==0) 
@@ -1609,7 +1704,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
         /// BLOCKS IN MG BORDERS ///
         ////////////////////////////
 
-        for (blockID b: blocks_in_borders) {
+        for (blockID b: Vars.border_blocks) {
             //double d = getBlockDelay(b, -1); //Carmine 18.02.22 delays of valid and ready are read from library
             string name_block, type_block;
             double D = -1.0;
@@ -1656,12 +1751,12 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                 ForAllOutputPorts(b, out_p) {
                     if (!MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(out_p)))) continue;
 
-                    int v_out = time_paths[out_p];
+                    int v_out = (*time_paths)[out_p];
 
                     ForAllInputPorts(b, in_p) {
                         if (!MG_disjoint[mg].hasBlock(getSrcBlock(getConnectedChannel(in_p)))) continue;
 
-                        int v_in = time_paths[in_p];
+                        int v_in = (*time_paths)[in_p];
                         //Carmine 24.03.22 this set of equations is inclued in the channel delays
                         /*double delayBlock_data; //Carmine 22.03.22 necessary to compute the delay on data path for constraints with buffers
                         if(getLatency(b)==0) 
@@ -1712,7 +1807,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                         if (!MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(out_p)))) continue;
 
                         double d_out = getPortDelay(out_p);
-                        int v_out = time_paths[out_p];
+                        int v_out = (*time_paths)[out_p];
                         if (d_out > Period) {
                             setError("Block " + getBlockName(b) + ": path constraints cannot be satisfied.");
                             return false;
@@ -1725,7 +1820,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                         if (!MG_disjoint[mg].hasBlock(getSrcBlock(getConnectedChannel(in_p)))) continue;
 
                         double d_in = getPortDelay(in_p);
-                        int v_in = time_paths[in_p];
+                        int v_in = (*time_paths)[in_p];
                         if (d_in + BufferDelay > Period) {
                             setError("Block " + getBlockName(b) + ": path constraints cannot be satisfied.");
                             return false;
@@ -1737,7 +1832,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                         if (!MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(out_p)))) continue;
 
                         double d_out = getPortDelay(out_p);
-                        int v_out = time_paths[out_p];
+                        int v_out = (*time_paths)[out_p];
                         if (d_out > Period) {
                             setError("Block " + getBlockName(b) + ": path constraints cannot be satisfied.");
                             return false;
@@ -1750,7 +1845,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                         if (!MG_disjoint[mg].hasBlock(getSrcBlock(getConnectedChannel(in_p)))) continue;
 
                         double d_in = getPortDelay(in_p);
-                        int v_in = time_paths[in_p];
+                        int v_in = (*time_paths)[in_p];
                         if (d_in + BufferDelay > Period) {
                             setError("Block " + getBlockName(b) + ": path constraints cannot be satisfied.");
                             return false;
@@ -1927,18 +2022,18 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                         string inp_regex_exp = "(.*)_in" + input.substr(1,1) + "_mg"+to_string(mg);
                                         string out_regex_exp = "(.*)_out" + output.substr(1,1) + "_mg"+to_string(mg);
                                         //string inp_regex_exp = "", out_regex_exp = "";
-                                        vector<int> time_paths_in, time_paths_out;
+                                        const milpVarMap *time_paths_in = nullptr, *time_paths_out = nullptr;
                                         bool inv_inp=false, inv_out=false;
                                         switch (input[0])
                                         {
                                         case 'd':
-                                            time_paths_in = Vars.time_path;
+                                            time_paths_in = &Vars.time_path;
                                             break;
                                         case 'v':
-                                            time_paths_in = Vars.time_valid_path;
+                                            time_paths_in = &Vars.time_valid_path;
                                             break;
                                         case 'r':
-                                            time_paths_in = Vars.time_ready_path;
+                                            time_paths_in = &Vars.time_ready_path;
                                             inv_inp=true;
                                             break;
                                         default:
@@ -1950,13 +2045,13 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                         switch (output[0])
                                         {
                                         case 'd':
-                                            time_paths_out = Vars.time_path;
+                                            time_paths_out = &Vars.time_path;
                                             break;
                                         case 'v':
-                                            time_paths_out = Vars.time_valid_path;
+                                            time_paths_out = &Vars.time_valid_path;
                                             break;
                                         case 'r':
-                                            time_paths_out = Vars.time_ready_path;
+                                            time_paths_out = &Vars.time_ready_path;
                                             inv_out=true;
                                             break;
                                         default:
@@ -1975,7 +2070,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                                 if(cnt_blocks >= size_MG_blocks && !MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(out_p))))
                                                     continue;
 
-                                                int ind = time_paths_out[out_p];
+                                                int ind = (*time_paths_out)[out_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_out)){
@@ -1989,7 +2084,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                                 if(cnt_blocks >= size_MG_blocks && !MG_disjoint[mg].hasBlock(getSrcBlock(getConnectedChannel(out_p))))
                                                     continue;
 
-                                                int ind = time_paths_out[out_p];
+                                                int ind = (*time_paths_out)[out_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_out)){
@@ -2005,7 +2100,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                                 if(cnt_blocks >= size_MG_blocks && !MG_disjoint[mg].hasBlock(getSrcBlock(getConnectedChannel(in_p))))
                                                     continue;
 
-                                                int ind = time_paths_in[in_p];
+                                                int ind = (*time_paths_in)[in_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_inp)){
@@ -2019,7 +2114,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_sc(Milp_Model &milp, milpVarsEB
                                                 if(cnt_blocks >= size_MG_blocks && !MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(in_p))))
                                                     continue;
 
-                                                int ind = time_paths_in[in_p];
+                                                int ind = (*time_paths_in)[in_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_inp)){
@@ -2072,7 +2167,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
     bool hasPeriod = Period > 0;
     if (not hasPeriod) Period = INFINITY;
 
-    vector<int> time_paths, ob_presence;
+    const milpVarMap *time_paths = nullptr, *ob_presence = nullptr;
     vector<string> modes;
     vector< pair<string, vector<double>>> block_delays = vector< pair<string, vector<double>>>(30); //Carmine 07.03.22 extract the delay of the component for the right bitwidth
 
@@ -2094,14 +2189,14 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
 
     for(string mode: modes){
         if(mode.compare("valid") == 0){
-            time_paths = Vars.time_valid_path;
-            ob_presence = Vars.buffer_flop_valid;
+            time_paths = &Vars.time_valid_path;
+            ob_presence = &Vars.buffer_flop_valid;
             
             if(FPL_22_CARMINE_LIB)
                 block_delays = read_lib_file(lib_path+"/delays_lib_valid.txt");
         }else if(mode.compare("ready") == 0){
-            time_paths = Vars.time_ready_path;
-            ob_presence = Vars.buffer_flop_ready;
+            time_paths = &Vars.time_ready_path;
+            ob_presence = &Vars.buffer_flop_ready;
             if(FPL_22_CARMINE_LIB)
                 block_delays = read_lib_file(lib_path+"/delays_lib_ready.txt");
         }else if(mode.compare("mixed") == 0){
@@ -2132,8 +2227,8 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
             || getBlockType(getDstBlock(c)) == MC || getBlockType(getSrcBlock(c)) == MC )
                 continue;
 
-            int v1 =  time_paths[getSrcPort(c)]; //modified
-            int v2 =  time_paths[getDstPort(c)]; //modified
+            int v1 =  (*time_paths)[getSrcPort(c)]; //modified
+            int v2 =  (*time_paths)[getDstPort(c)]; //modified
 
             if(mode.compare("ready") == 0){ //Carmine 17.02.22 // the ready signal direction is opposite to the one of valid
                 int tmp = v1;
@@ -2141,7 +2236,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                 v2 = tmp;
             }
 
-            int R = ob_presence[c];
+            int R = (*ob_presence)[c];
 
             if (hasPeriod) {
                 // v1, v2 <= Period
@@ -2224,11 +2319,11 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
             if(!channelIsCovered(c, true, true, false)){ //Carmine 18.02.22 if channel is covered there is no need to question the presence of buffers
                 //Carmine 17.02.22 //the presence of a buffer has to be consistent among different timing domains
                 if(mode.compare("valid") == 0){
-                    milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,ob_presence[c]}}, '=', 0);
+                    milp.newRow( {{1,Vars.buffer_flop[c]}, {-1,(*ob_presence)[c]}}, '=', 0);
                 }else if(mode.compare("ready") == 0){
                     if ((getBlockType(getSrcBlock(c)) == MUX)     //Carmine 21.02.22 MILP should be aware of presence of transparent buffers in MUX and MERGE
                     || (getBlockType(getSrcBlock(c)) == MERGE && getPorts(getSrcBlock(c), INPUT_PORTS).size() > 1)) {
-                        milp.newRow( {{1,ob_presence[c]}}, '>', 1); 
+                        milp.newRow( {{1,(*ob_presence)[c]}}, '>', 1); 
                     }
                 }
             }
@@ -2281,10 +2376,10 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
             // First: combinational blocks
             //if (getLatency(b) == 0) { //Carmine 18.02.22 for valid and ready the latency is 0
             ForAllOutputPorts(b, out_p) {
-                int v_out = time_paths[out_p];
+                int v_out = (*time_paths)[out_p];
 
                 ForAllInputPorts(b, in_p) {
-                    int v_in = time_paths[in_p];
+                    int v_in = (*time_paths)[in_p];
                     //Carmine 24.03.22 this set of equations is inclued in the channel delays
                     /*double delayBlock_data; //Carmine 22.03.22 necessary to compute the delay on data path for constraints with buffers
                     if(getLatency(b)==0) 
@@ -2494,18 +2589,18 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                         string inp_regex_exp = "(.*)_in" + input.substr(1,1);
                                         string out_regex_exp = "(.*)_out" + output.substr(1,1);
                                         //string inp_regex_exp = "", out_regex_exp = "";
-                                        vector<int> time_paths_in, time_paths_out;
+                                        const milpVarMap *time_paths_in = nullptr, *time_paths_out = nullptr;
                                         bool inv_inp=false, inv_out=false;
                                         switch (input[0])
                                         {
                                         case 'd':
-                                            time_paths_in = Vars.time_path;
+                                            time_paths_in = &Vars.time_path;
                                             break;
                                         case 'v':
-                                            time_paths_in = Vars.time_valid_path;
+                                            time_paths_in = &Vars.time_valid_path;
                                             break;
                                         case 'r':
-                                            time_paths_in = Vars.time_ready_path;
+                                            time_paths_in = &Vars.time_ready_path;
                                             inv_inp=true;
                                             break;
                                         default:
@@ -2517,13 +2612,13 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                         switch (output[0])
                                         {
                                         case 'd':
-                                            time_paths_out = Vars.time_path;
+                                            time_paths_out = &Vars.time_path;
                                             break;
                                         case 'v':
-                                            time_paths_out = Vars.time_valid_path;
+                                            time_paths_out = &Vars.time_valid_path;
                                             break;
                                         case 'r':
-                                            time_paths_out = Vars.time_ready_path;
+                                            time_paths_out = &Vars.time_ready_path;
                                             inv_out=true;
                                             break;
                                         default:
@@ -2538,7 +2633,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                         if(!inv_out){
                                             ForAllOutputPorts(b, out_p) {
                                                 
-                                                int ind = time_paths_out[out_p];
+                                                int ind = (*time_paths_out)[out_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_out)){
@@ -2549,7 +2644,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                             ForAllInputPorts(b, out_p) {
                                                 
 
-                                                int ind = time_paths_out[out_p];
+                                                int ind = (*time_paths_out)[out_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_out)){
@@ -2562,7 +2657,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                             ForAllInputPorts(b, in_p) {
                                                 
 
-                                                int ind = time_paths_in[in_p];
+                                                int ind = (*time_paths_in)[in_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_inp)){
@@ -2573,7 +2668,7 @@ bool DFnetlist_Impl::createPathConstraintsOthers_remaining(Milp_Model &milp, mil
                                             ForAllOutputPorts(b, in_p) {
                                                 
 
-                                                int ind = time_paths_in[in_p];
+                                                int ind = (*time_paths_in)[in_p];
                                                 string var_name = milp.getVarName(ind);
                                                 
                                                 if(regex_match(var_name, reg_inp)){
@@ -2812,8 +2907,7 @@ bool DFnetlist_Impl::createElasticityConstraints_sc(Milp_Model &milp, milpVarsEB
     /// CHANNELS IN MG BORDER ///
     /////////////////////////////
     //cout << "   elasticity constraints for channels in MG border" << endl;
-    for (channelID c: channels_in_borders) {
-        if (!MG_disjoint[mg].hasBlock(getSrcBlock(c)) && !MG_disjoint[mg].hasBlock(getDstBlock(c))) continue;
+    for (channelID c: Vars.border_channels) {
 
         int v1 = Vars.time_elastic[getSrcPort(c)];
         int v2 = Vars.time_elastic[getDstPort(c)];
@@ -2847,7 +2941,7 @@ bool DFnetlist_Impl::createElasticityConstraints_sc(Milp_Model &milp, milpVarsEB
     /// BLOCKS IN MG BORDER ///
     ///////////////////////////
     //cout << "   elasticity constraints for blocks in MG border" << endl;
-    for (blockID b: blocks_in_borders) {
+    for (blockID b: Vars.border_blocks) {
         ForAllOutputPorts(b, out_p) {
             if (!MG_disjoint[mg].hasBlock(getDstBlock(getConnectedChannel(out_p)))) continue;
 
@@ -3473,20 +3567,45 @@ void DFnetlist_Impl::dumpMilpSolution(const Milp_Model& milp, const milpVarsEB&
 
 }
 
-void DFnetlist_Impl::writeRetimingDiffs(const Milp_Model& milp, const milpVarsEB& vars)
+void DFnetlist_Impl::getBufferSolutionMG(milpResultMG& res, int mg, bool MaxThroughput, bool first_MG, const std::string& model_mode)
 {
-    ForAllBlocks(b) {
-        int in_ret = vars.in_retime_tokens[0][b];
-        if (in_ret < 0) continue; 
-        int out_ret = vars.out_retime_tokens[0][b];
-        int ret_bub = vars.retime_bubbles[0][b];
-        //cout << "Block " << getBlockName(b) << ": ";
-        if (in_ret == out_ret) {
-            if(milp[in_ret] < 0.001) continue; //Carmine 01.03.22 if the retiming timing is very small approximate it to 0
-            setBlockRetimingDiff(b, milp[in_ret]);
-        } else {
-			setBlockRetimingDiff(b, milp[out_ret] - milp[in_ret]);
+    const Milp_Model& milp = res.milp;
+    const milpVarsEB& vars = res.vars;
+    bufferSolutionMG& sol = res.solution;
+    sol = bufferSolutionMG();
+
+    bool opaque_ready = model_mode.compare("ready")==0 || model_mode.compare("all")==0 || model_mode.compare("mixed")==0;
+    for (channelID c: MG_disjoint[mg].getChannels()) {
+        if (channelIsCovered(c, false, true, true)) continue;
+        if (milp[vars.buffer_slots[c]] <= 0.5) continue;
+
+        bufferSolutionMG::buffer buf;
+        buf.c = c;
+        buf.slots = milp[vars.buffer_slots[c]] + 0.5; // Automatically truncated
+        buf.transparent = milp.isFalse(vars.buffer_flop[c]);
+        buf.eb = opaque_ready and not buf.transparent and milp.isTrue(vars.buffer_flop_ready[c]);
+        sol.buffers.push_back(buf);
+    }
+
+    // Retiming diffs
+    if (not vars.in_retime_tokens.empty()) {
+        ForAllBlocks(b) {
+            int in_ret = vars.in_retime_tokens[0][b];
+            if (in_ret < 0) continue;
+            int out_ret = vars.out_retime_tokens[0][b];
+            if (in_ret == out_ret) {
+                if(milp[in_ret] < 0.001) continue; //Carmine 01.03.22 if the retiming timing is very small approximate it to 0
+                sol.retiming.push_back(make_pair(b, milp[in_ret]));
+            } else {
+                sol.retiming.push_back(make_pair(b, milp[out_ret] - milp[in_ret]));
+            }
+        }
+    }
+
+    if (MaxThroughput) {
+        for (auto sub_mg: components[mg]) {
+            sol.throughput.push_back(milp[vars.th_MG[sub_mg]]);
+            if (first_MG) break;
         }
-        //cout << ", Retiming bub = " << milp[ret_bub] << endl;
     }
 }
@@ -7,7 +7,9 @@
 // This file is used for finding path info in the important
 // cycles of the CDFG
 
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <sstream>
 #include <iomanip>
@@ -17,6 +19,8 @@
 #include <algorithm>
 #include <cstring>
 #include <list>
+#include <map>
+#include <set>
 #include <stack>
 #include <fstream>
 #include "DFnetlist.h"
@@ -24,6 +28,18 @@
 using namespace Dataflow;
 using namespace std;
 
+// Name of the file with the throughput of the MGs for a case of the lsq_sizing flow
+static string lsqThroughputFile(const string& dot_name, int selected_case)
+{
+    if (selected_case == 1) {
+        return dot_name + "_worst_II.log";
+    } else if (selected_case == 0) {
+        return dot_name + "_best_II.log";
+    } else {
+        return dot_name + "_variable_II.log";
+    }
+}
+
 /**
  * @brief main function for the lsq_sizing flow.
  * @param coverage Desired coverage for MG calculation.
@@ -34,6 +50,110 @@ using namespace std;
  * @note Start point of the lsq_sizing flow
  */
 bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFnetlist& out_netlist, int selected_case){
+    if (not prepareLSQSizing(coverage)) return false;
+
+    std::vector<std::string> throughput_var_value;
+    if (not readLSQThroughput(dot_name, selected_case, throughput_var_value)) return false;
+
+    int opt_load_depth = 0;
+    int opt_store_depth = 0;
+    if (not computeLSQDepths(selected_case, throughput_var_value, opt_load_depth, opt_store_depth)) return false;
+
+    // Modify the Dot file for optimal Load and Store Queue size
+    // For now, just read the dot file again and modify the dot accordingly for the new json file
+    cout << endl;
+    cout << "**********************" << endl;
+    cout << "Modify the DOT file" << endl;
+    cout << "**********************" << endl;
+    cout << endl;
+
+    string suffix = "_optimized.dot"; //"_graph_buf.dot"
+    cout << "Reading " << dot_name + suffix << endl;
+
+    // For now, only one LSQ block is considered, the Dot file can only have 1 LSQ block!
+    // TODO: extend the flow to support multiple LSQ blocks inside one Dot file
+    // One thing is that the index of LSQ node in the original dot and the newly read dot file is not the same!!!
+    ForAllBlocks(b) {
+        // If this is a LSQ block
+        if (getBlockType(b) == LSQ) {
+            // This must be a valid block
+            assert(validBlock(b));
+
+            // Change the depth of the LSQ
+            cout << "Change the params of block " << getBlockName(b) << endl;
+            out_netlist.changeOutDot(getBlockName(b), opt_load_depth, opt_store_depth);
+        }
+    }
+
+    // Write back the new dot file
+    cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+    cout << endl;
+    cout << "Generate the new dot file "+ dot_name + "_optimized_lsq.dot" << endl;
+    out_netlist.writeDot(dot_name + "_optimized_lsq.dot");
+    out_netlist.writeDotBB(dot_name + "_bbgraph_lsq.dot");
+
+    return 1;
+}
+
+/**
+ * @brief lsq_sizing flow for several cases in one run. The MGs and their paths are extracted once,
+ * and the timing info and depths of the LSQ are calculated for the throughput of every case.
+ * @param coverage Desired coverage for MG calculation.
+ * @param dot_name Name of the dot file after buffers flow (prefix of the throughput files).
+ * @param cases Cases to calculate (0: best, 1: worst, 2: variable throughput).
+ * @return True if the depths of all the cases have been calculated, and false if not.
+ * @note The table with the depths of every case is printed and written in <dot_name>_lsq_depths.txt.
+ */
+bool DFnetlist_Impl::batchLSQSizing(double coverage, const std::string& dot_name, const std::vector<int>& cases){
+    if (not prepareLSQSizing(coverage)) return false;
+
+    const char* case_names[] = {"best", "worst", "variable"};
+    ostringstream table;
+    table << left << setw(10) << "case" << setw(12) << "load_depth" << setw(12) << "store_depth" << "throughput" << endl;
+
+    bool all_cases = true;
+    for (int selected_case: cases) {
+        cout << endl;
+        cout << "###################################################" << endl;
+        cout << "Calculating LSQ depths for case " << selected_case << endl;
+        cout << "###################################################" << endl;
+
+        std::vector<std::string> throughput_var_value;
+        int opt_load_depth = 0;
+        int opt_store_depth = 0;
+        table << setw(10) << case_names[selected_case];
+        if (readLSQThroughput(dot_name, selected_case, throughput_var_value) and
+            computeLSQDepths(selected_case, throughput_var_value, opt_load_depth, opt_store_depth)) {
+            table << setw(12) << opt_load_depth << setw(12) << opt_store_depth;
+        } else {
+            table << setw(12) << "-" << setw(12) << "-";
+            all_cases = false;
+        }
+        table << lsqThroughputFile(dot_name, selected_case) << endl;
+    }
+
+    cout << endl;
+    cout << "***********************************************" << endl;
+    cout << "LSQ depths for all cases" << endl;
+    cout << "***********************************************" << endl;
+    cout << table.str() << endl;
+
+    string error;
+    if (not FileUtil::write(table.str(), dot_name + "_lsq_depths.txt", error)) {
+        setError(error);
+        return false;
+    }
+
+    return all_cases;
+}
+
+/**
+ * @brief First part of the lsq_sizing flow, which does not depend on the throughput: extraction of the MGs,
+ * of the nodes connected to the LSQ and of the loopback edges, and search of the paths used for the timing info.
+ * @param coverage Desired coverage for MG calculation.
+ * @return True if the flow can go on, and false if not (no LSQ in the netlist).
+ */
+bool DFnetlist_Impl::prepareLSQSizing(double coverage){
     // Variable Definition for the whole flow
     End_points.clear();
     // Adjacent_nodes_store.clear();
@@ -41,8 +161,7 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     End_points_Store_queue.clear();
     Start_points.clear();
     MP.clear();
-    TL_traces.clear();
-    T_BB.clear();
+    MP_BB.clear();
     vector<int> latency_vector; // Store the latency of the found path
     loopback_edge.clear();
     set<blockID> path_set;
@@ -84,11 +203,87 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     cout << "STAGE 4: Extract nodes that are connected to the LSQ" << endl;
     cout << "****************************************************" << endl;
     cout << endl;
-    for (auto sel_MG: MG_post_buffer) {
+    for (auto& sel_MG: MG_post_buffer) {
         // cout << "[Extracting nodes that are connected to the LSQ]" << endl;
         extractLSQnodes(sel_MG);
     }
 
+    // Stage 6: Build Adjacency list for all MGs
+    cout << "****************************************************" << endl;
+    cout << "STAGE 6: Build Adjacency lists for all MGs" << endl;
+    cout << "****************************************************" << endl;
+    cout << endl;
+    getAdjRecordfromMGs(MG_post_buffer);
+
+    // Stage 7: Cut down loopback edges for all MGs
+    cout << "****************************************************" << endl;
+    cout << "STAGE 7: Change the latency of the branch nodes " << endl;
+    cout << "****************************************************" << endl;
+    cout << endl;
+
+    for (int i = 0; i < MG_post_buffer.size(); i++) {
+        cout << "Change the latency for branch nodes in MG " << i << endl;
+        loopbackChange(MG_post_buffer[i], i);
+    }
+
+    // Stage 8: Extract all simple paths in all MGs
+    // From the start_point of the MG to all End_points
+    cout << "****************************************************" << endl;
+    cout << "STAGE 8: Extract all simple paths in all MGs" << endl;
+    cout << "****************************************************" << endl;
+    cout << endl;
+
+    // Testing
+    cout << "Contents in Start_Points:" << endl;
+    for (auto com_start: Start_points) {
+        cout << "   " << getBlockName(com_start) << endl;
+    }
+
+    for (int i = 0; i < MA.size(); i++) {
+        // Testing
+        cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+        cout << "Searching all simple paths in MG " << i << endl;
+        cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+        // The longest paths to all the end points are found at once
+        std::vector<blockID> MG_end_points;
+        for (auto end_point: End_points) {
+            if (MG_post_buffer[i].hasBlock(end_point)) {
+                // Testing
+                cout << "[Finding paths] Searching path for node " << getBlockName(end_point) << endl;
+
+                MG_end_points.push_back(end_point);
+            } else {
+                // Key is not found
+                cout << "[WARNING] Block " << getBlockName(end_point) << " is not found in the MG_post_buffer!!!" << endl;
+            }
+        }
+        MP.push_back(findLongestPathsinMG(MA[i], Start_points[i], MG_end_points, i));
+    }
+
+    // Shortest paths from the start point of the MG to the start of every BB (used for TBB)
+    for (int i = 0; i < MA.size(); i++) {
+        mgPathInfo bb_paths;
+        for (auto BB_index: MG_post_buffer[i].getBasicBlocks()) {
+            blockID bb_start_point = BB_StartPoints[i].get_an_element(BB_index);
+            std::vector<int> path_index = {Start_points[i], bb_start_point};
+            if (bb_paths.hasKey(path_index)) continue;
+            mgPathInfo found_path = findPathsinMG(MA[i], Start_points[i], bb_start_point, 1, i);
+            for (blockID b: found_path.getaPath(path_index)) bb_paths.insertBlock(path_index, b);
+        }
+        MP_BB.push_back(bb_paths);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Reads the throughput of the MGs for one case and calculates their II.
+ * @param dot_name Name of the dot file after buffers flow (prefix of the throughput files).
+ * @param selected_case User specified case for calculation (0: best, 1: worst, 2: variable throughput).
+ * @param throughput_var_value Input sequences of the MGs for the variable throughput (output).
+ * @return True if the throughput has been read, and false if not.
+ */
+bool DFnetlist_Impl::readLSQThroughput(const std::string& dot_name, int selected_case, std::vector<std::string>& throughput_var_value){
     // Stage 5: Calculate II for each MG
     // Extract nodes connected to the store block
     // Two flows needed for calculating the II, best case II and worst case II
@@ -99,7 +294,8 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
 
     // Variable definition
     std::vector<double> throughput_value;
-    std::vector<std::string> throughput_var_value;
+    throughput_var_value.clear();
+    II_traces.clear();
     int MG_counter = 0;
     std::string MG_throughput;
     std::vector<int> II_value;
@@ -107,13 +303,7 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     ifstream in_file;
 
     // Read the throughput from the log file
-    if (selected_case == 1) {
-        throughput_file = dot_name + "_worst_II.log";
-    } else if (selected_case == 0) {
-        throughput_file = dot_name + "_best_II.log";
-    } else {
-        throughput_file = dot_name + "_variable_II.log";
-    }
+    throughput_file = lsqThroughputFile(dot_name, selected_case);
 
     
     cout << "Reading the throughput from " << throughput_file << endl;
@@ -188,61 +378,29 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
 
     }
 
-    // Stage 6: Cut down loopback edges for all MGs
-    cout << "****************************************************" << endl;
-    cout << "STAGE 6: Change the latency of the branch nodes " << endl;
-    cout << "****************************************************" << endl;
-    cout << endl;
-
-    for (int i = 0; i < MG_post_buffer.size(); i++) {
-        cout << "Change the latency for branch nodes in MG " << i << endl;
-        loopbackChange(MG_post_buffer[i], i);
-    }
-
-    // Stage 7: Build Adjacency list for all MGs
-    cout << "****************************************************" << endl;
-    cout << "STAGE 7: Build Adjacency lists for all MGs" << endl;
-    cout << "****************************************************" << endl;
-    cout << endl;
-    getAdjRecordfromMGs(MG_post_buffer);
-
-    // Stage 8: Extract all simple paths in all MGs
-    // From the start_point of the MG to all End_points
-    cout << "****************************************************" << endl;
-    cout << "STAGE 8: Extract all simple paths in all MGs" << endl;
-    cout << "****************************************************" << endl;
-    cout << endl;
-
-    // Testing
-    cout << "Contents in Start_Points:" << endl;
-    for (auto com_start: Start_points) {
-        cout << "   " << getBlockName(com_start) << endl;
-    }
-
-    for (int i = 0; i < MA.size(); i++) {
-        // Testing
-        cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-        cout << "Searching all simple paths in MG " << i << endl;
-        cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-        for (auto end_point: End_points) {
-            if (MG_post_buffer[i].hasBlock(end_point)) {
-                // Testing
-                cout << "[Finding paths] Searching path for node " << getBlockName(end_point) << endl;
-
-                MP.push_back(findPathsinMG(MA[i], Start_points[i], end_point, 0, i));
-            } else {
-                // Key is not found
-                cout << "[WARNING] Block " << getBlockName(end_point) << " is not found in the MG_post_buffer!!!" << endl;
-            }
-        }
-    }
+    return true;
+}
 
+/**
+ * @brief Second part of the lsq_sizing flow: calculation of the timing info and of the depths of the LSQ
+ * for the II read by readLSQThroughput.
+ * @param selected_case User specified case for calculation
+ * @param throughput_var_value Input sequences of the MGs for the variable throughput.
+ * @param opt_load_depth Optimal depth of the load queue (output).
+ * @param opt_store_depth Optimal depth of the store queue (output).
+ * @return True if the depths have been calculated, and false if not.
+ */
+bool DFnetlist_Impl::computeLSQDepths(int selected_case, const std::vector<std::string>& throughput_var_value,
+                                      int& opt_load_depth, int& opt_store_depth){
     // Stage 9: Calculate TL for different paths in different MGs
     cout << "****************************************************" << endl;
     cout << "STAGE 9: Calculate TL for all paths in all MGs" << endl;
     cout << "****************************************************" << endl;
     cout << endl;
     // Variable Definition
+    TL_traces.clear();
+    T_iter.clear();
+    T_BB.clear();
     int flag_path = 0; // Used to show the validity of the path
     std::vector<int> path_index;
     int path_latency = 0;
@@ -352,7 +510,6 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     cout << endl;
 
     // Variable definition
-    mgPathInfo temp_path;
     BB_info temp_bb_time;
     blockID bb_start_point;
     path_latency = 0;
@@ -363,7 +520,6 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
         cout << "================== Extracting TBB for MG " << i << " ==================" << endl;
 
         temp_bb_time.clear();
-        temp_path.clear();
 
         // Check for different BBs
         for (auto BB_index: MG_post_buffer[i].getBasicBlocks()) {
@@ -381,8 +537,7 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
             // Set the index
             path_index.push_back(Start_points[i]);
             path_index.push_back(bb_start_point);
-            temp_path = findPathsinMG(MA[i], Start_points[i], bb_start_point, 1, i);
-            path_latency = pathLatency(temp_path.getaPath(path_index), i);
+            path_latency = pathLatency(MP_BB[i].getaPath(path_index), i);
 
             // Testing
             cout << endl;
@@ -410,8 +565,8 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     std::vector<int> Optimal_Load_Depth;
     std::vector<int> load_depth_list;
     std::vector<int> store_depth_list;
-    int opt_load_depth = 0;
-    int opt_store_depth = 0;
+    opt_load_depth = 0;
+    opt_store_depth = 0;
 
     // Check the value
     for (int i = 0; i < MG_post_buffer.size(); i++) {
@@ -446,40 +601,96 @@ bool DFnetlist_Impl::buildAdjMatrix(double coverage, std::string& dot_name, DFne
     cout << "***********************************************" << endl;
     cout << endl;
 
-    // Modify the Dot file for optimal Load and Store Queue size
-    // For now, just read the dot file again and modify the dot accordingly for the new json file
-    cout << endl;
-    cout << "**********************" << endl;
-    cout << "Modify the DOT file" << endl;
-    cout << "**********************" << endl;
-    cout << endl;
+    return true;
+}
 
-    string suffix = "_optimized.dot"; //"_graph_buf.dot"
-    cout << "Reading " << dot_name + suffix << endl;
+/**
+ * @brief Micro-benchmark of the traversals of the lsq_sizing flow on the MGs of the netlist.
+ * @param coverage Desired coverage for MG calculation.
+ * @param iterations Number of times each stage is run.
+ * @return True if the benchmark was run, and false if the netlist has no LSQ.
+ * @note The MGs are extracted once. Then the adjacency records are built, the LSQ nodes and
+ * loopback edges are extracted and the paths are searched (longest paths to the LSQ nodes and
+ * shortest paths to the start of every BB) the given number of times. The output of the stages
+ * is discarded and the average time of each stage is reported.
+ */
+bool DFnetlist_Impl::benchmarkPathSearch(double coverage, int iterations) {
+    if (not needLSQFLow()) {
+        cout << "No LSQ node detected in the specified DOT file" << endl;
+        return false;
+    }
 
-    // For now, only one LSQ block is considered, the Dot file can only have 1 LSQ block!
-    // TODO: extend the flow to support multiple LSQ blocks inside one Dot file
-    // One thing is that the index of LSQ node in the original dot and the newly read dot file is not the same!!!
-    ForAllBlocks(b) {
-        // If this is a LSQ block
-        if (getBlockType(b) == LSQ) {
-            // This must be a valid block
-            assert(validBlock(b));
+    Start_points.clear();
+    extractMGsBB_post_Buffer(coverage);
 
-            // Change the depth of the LSQ
-            cout << "Change the params of block " << getBlockName(b) << endl;
-            out_netlist.changeOutDot(getBlockName(b), opt_load_depth, opt_store_depth);
+    using clock = std::chrono::steady_clock;
+    double t_adj = 0, t_lsq = 0, t_loopback = 0, t_longest = 0, t_shortest = 0;
+    long num_paths = 0;
+    auto elapsed = [](clock::time_point t0) {
+        return std::chrono::duration<double, std::micro>(clock::now() - t0).count();
+    };
+
+    // The stages are verbose: their output is discarded while measuring
+    ofstream null_stream;
+    streambuf* cout_buf = cout.rdbuf(null_stream.rdbuf());
+
+    for (int it = 0; it < iterations; it++) {
+        clock::time_point t0 = clock::now();
+        getAdjRecordfromMGs(MG_post_buffer);
+        t_adj += elapsed(t0);
+
+        t0 = clock::now();
+        End_points.clear();
+        End_points_Load_queue.clear();
+        End_points_Store_queue.clear();
+        for (auto& sel_MG: MG_post_buffer) extractLSQnodes(sel_MG);
+        t_lsq += elapsed(t0);
+
+        t0 = clock::now();
+        loopback_edge.clear();
+        for (int i = 0; i < MG_post_buffer.size(); i++) loopbackChange(MG_post_buffer[i], i);
+        t_loopback += elapsed(t0);
+
+        num_paths = 0;
+        t0 = clock::now();
+        for (int i = 0; i < MA.size(); i++) {
+            std::vector<blockID> MG_end_points;
+            for (blockID end_point: End_points) {
+                if (MG_post_buffer[i].hasBlock(end_point)) MG_end_points.push_back(end_point);
+            }
+            findLongestPathsinMG(MA[i], Start_points[i], MG_end_points, i);
+            num_paths += MG_end_points.size();
+        }
+        t_longest += elapsed(t0);
+
+        t0 = clock::now();
+        for (int i = 0; i < MA.size(); i++) {
+            for (auto BB_index: MG_post_buffer[i].getBasicBlocks()) {
+                findShortestPathinMG(MA[i], Start_points[i], BB_StartPoints[i].get_an_element(BB_index));
+                num_paths++;
+            }
         }
+        t_shortest += elapsed(t0);
     }
 
-    // Write back the new dot file
-    cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
-    cout << endl;
-    cout << "Generate the new dot file "+ dot_name + "_optimized_lsq.dot" << endl;
-    out_netlist.writeDot(dot_name + "_optimized_lsq.dot");
-    out_netlist.writeDotBB(dot_name + "_bbgraph_lsq.dot");
+    cout.rdbuf(cout_buf);
 
-    return 1;
+    int num_blocks = 0, num_edges = 0;
+    for (const auto& adj: MA) {
+        num_blocks += adj.numBlock();
+        num_edges += adj.succ.size();
+    }
+
+    cout << endl;
+    cout << "Path search benchmark: " << MA.size() << " MGs, " << num_blocks << " blocks, " << num_edges
+         << " edges, " << num_paths << " paths, " << iterations << " iterations" << endl;
+    cout << fixed << setprecision(2);
+    cout << "   Adjacency records:  " << t_adj / iterations << " us" << endl;
+    cout << "   LSQ nodes:          " << t_lsq / iterations << " us" << endl;
+    cout << "   Loopback edges:     " << t_loopback / iterations << " us" << endl;
+    cout << "   Longest paths:      " << t_longest / iterations << " us" << endl;
+    cout << "   Shortest paths:     " << t_shortest / iterations << " us" << endl;
+    return true;
 }
 
 /**
@@ -551,6 +762,10 @@ void DFnetlist_Impl::extractMGsBB_post_Buffer(double coverage) {
 
     BBG.calculateBackArcs();
 
+    // The model is built once and updated at every iteration
+    milpVarsCFDFC vars;
+    createMilpCFDFC(freq, vars);
+
     int iter = 1;
     int MG_count = 0;
     BB_info temp_start_points;
@@ -559,7 +774,7 @@ void DFnetlist_Impl::extractMGsBB_post_Buffer(double coverage) {
         cout << "--------------------------------------------------------------" << endl;
         cout << "Post Buffers_Adding Iteration " << iter << endl;
 
-        subNetlistBB extracted_CFDFC = extractMarkedGraphBB(freq);
+        subNetlistBB extracted_CFDFC = extractMarkedGraphBB(freq, vars);
 
         if (extracted_CFDFC.empty()){
             cout << "No new MG can be extracted to increase coverage." << endl;
@@ -946,6 +1161,11 @@ void DFnetlist_Impl::extractLSQnodes(DFnetlist_Impl::subNetlistPostBuffer &sel_M
     cout << "Extracting nodes that are connected to the LSQ" <<  endl;
     cout << "==============================================" << endl;
 
+    // End points already found (indexed by blockID)
+    blockBitset found_end_points;
+    found_end_points.reset(blocks.size());
+    for (blockID b: End_points) found_end_points.set(b);
+
     // Check the corresponding connection
     ForAllChannels(i) {
         blockID src_index = getSrcBlock(i);
@@ -953,10 +1173,11 @@ void DFnetlist_Impl::extractLSQnodes(DFnetlist_Impl::subNetlistPostBuffer &sel_M
 
         // Check whether one of them is from LSQ
         if (getBlockType(src_index) == LSQ) {
-            if (find(End_points.begin(), End_points.end(), dst_index) == End_points.end()){
+            if (not found_end_points.test(dst_index)) {
                 if (sel_MG.hasBlock(dst_index)){
                     if (getBlockType(dst_index) == OPERATOR) {
                         End_points.push_back(dst_index);
+                        found_end_points.set(dst_index);
                         // Check whether this is a store or load node
                         if (getOperation(dst_index) == "lsq_load_op") {
                             End_points_Load_queue.push_back(dst_index);
@@ -970,10 +1191,11 @@ void DFnetlist_Impl::extractLSQnodes(DFnetlist_Impl::subNetlistPostBuffer &sel_M
                 // cout << getBlockName(dst_index) << " is already in the Stored connected nodes" <<  endl;
             }
         } else if (getBlockType(dst_index) == LSQ) {
-            if (find(End_points.begin(), End_points.end(), src_index) == End_points.end()){
+            if (not found_end_points.test(src_index)) {
                 if (sel_MG.hasBlock(src_index)){
                     if (getBlockType(src_index) == OPERATOR) {
                         End_points.push_back(src_index);
+                        found_end_points.set(src_index);
                         // Check whether this is a store or load node
                         if (getOperation(src_index) == "lsq_load_op") {
                             End_points_Load_queue.push_back(src_index);
@@ -1032,36 +1254,37 @@ bool DFnetlist_Impl::loopbackChange(DFnetlist_Impl::subNetlistPostBuffer &sel_MG
     cout << endl;
 
     // Mark all loopback edges
+    const graphAdjrecord& adj = MA[MG_index];
     for (auto Phi_node: MUX_nodes) {
         // Testing
         cout << "Search for loopback edges that are connected to " << getBlockName(Phi_node) << endl;
-        // Checking all those channels
-        for (auto sel_channel: sel_MG.getChannels()) {
-            // The Phi_node shall be the dst node for the channel
-            if (getDstBlock(sel_channel) == Phi_node) {
-                if (getBlockType(getSrcBlock(sel_channel)) == BRANCH) {
-                    // Check whether the src node is in the
-                    cout << "The selected node is " << getBlockName(getSrcBlock(sel_channel)) << endl;
-                    if (BB_set.count(getBasicBlock(getSrcBlock(sel_channel))) > 0) {
-                        // The src node is in the selected Marked Graph, branch nodes
-                        loop_back_edge = sel_channel;
-
-                        // Check whether this is a loopback edge
-                        if (isBackEdge(loop_back_edge)){
-                            // Testing
-                            cout << endl;
-                            cout << "One loopback edge found" << endl;
-                            // Change the latency of the selected node
-                            //                        setLatency(getSrcBlock(sel_channel), II_traces[MG_index][0]);
-                            // cout << endl;
-                            cout << "The loopback edge: [Start_Point] " << getBlockName(getSrcBlock(loop_back_edge)) << "; [End_Point] " << getBlockName(getDstBlock(loop_back_edge)) << endl;
-                            cout << "Insert the found edge " << loop_back_edge << " to loopback_edge" << endl;
-                            loopback_edge.insert(loop_back_edge);
-                            // del_edge_MGs(sel_channel);
-                            // Remove the loopback edge
-                            // removeChannel(loop_back_edge);
-                            break;
-                        }
+        int phi = adj.getIndex(Phi_node);
+        if (phi < 0) continue;
+        // Checking all the channels whose dst node is the Phi_node
+        for (int k = adj.in_start[phi]; k < adj.in_start[phi + 1]; k++) {
+            channelID sel_channel = adj.in_channel[k];
+            if (getBlockType(getSrcBlock(sel_channel)) == BRANCH) {
+                // Check whether the src node is in the
+                cout << "The selected node is " << getBlockName(getSrcBlock(sel_channel)) << endl;
+                if (BB_set.count(getBasicBlock(getSrcBlock(sel_channel))) > 0) {
+                    // The src node is in the selected Marked Graph, branch nodes
+                    loop_back_edge = sel_channel;
+
+                    // Check whether this is a loopback edge
+                    if (isBackEdge(loop_back_edge)){
+                        // Testing
+                        cout << endl;
+                        cout << "One loopback edge found" << endl;
+                        // Change the latency of the selected node
+                        //                        setLatency(getSrcBlock(sel_channel), II_traces[MG_index][0]);
+                        // cout << endl;
+                        cout << "The loopback edge: [Start_Point] " << getBlockName(getSrcBlock(loop_back_edge)) << "; [End_Point] " << getBlockName(getDstBlock(loop_back_edge)) << endl;
+                        cout << "Insert the found edge " << loop_back_edge << " to loopback_edge" << endl;
+                        loopback_edge.insert(loop_back_edge);
+                        // del_edge_MGs(sel_channel);
+                        // Remove the loopback edge
+                        // removeChannel(loop_back_edge);
+                        break;
                     }
                 }
             }
@@ -1082,7 +1305,7 @@ bool DFnetlist_Impl::getAdjRecordfromMGs(std::vector<DFnetlist_Impl::subNetlistP
     MA.clear();
 
     // Build Adj list for different blocks based on the extracted MGs
-    for (auto iter : Marked_Graphs) {
+    for (auto& iter : Marked_Graphs) {
         // Create graphAdjrecord structure and clear it
         graphAdjrecord extracted_Adj_Record;
         extracted_Adj_Record.clear();
@@ -1093,9 +1316,11 @@ bool DFnetlist_Impl::getAdjRecordfromMGs(std::vector<DFnetlist_Impl::subNetlistP
         // Two important things:
         // 1. Store blocks are not connecting to any other blocks inside BB, so the adjacency
         //    list for store blocks should always be empty
+        std::vector<graphAdjrecord::adjEdge> edges;
         for (channelID c: iter.getChannels()) {
-            extracted_Adj_Record.insertBlock(getSrcBlock(c), getDstBlock(c));
+            edges.push_back({c, getSrcBlock(c), getDstBlock(c), isBackEdge(c)});
         }
+        extracted_Adj_Record.build(edges);
 
         // Add the record to MA
         MA.push_back(extracted_Adj_Record);
@@ -1103,9 +1328,10 @@ bool DFnetlist_Impl::getAdjRecordfromMGs(std::vector<DFnetlist_Impl::subNetlistP
         // Testing
 //        cout << "-------------------------------" << endl;
 //        cout << "Adjacency lists of Marked Graph:" << endl;
-//        for (auto record_map: extracted_Adj_Record.adj) {
-//            cout << "Adj list for block " << getBlockName(record_map.first) << " : " ;
-//            for (auto adj_block: record_map.second) {
+//        for (int i = 0; i < extracted_Adj_Record.numBlock(); i++) {
+//            cout << "Adj list for block " << getBlockName(extracted_Adj_Record.blocks[i]) << " : " ;
+//            for (int k = extracted_Adj_Record.succ_start[i]; k < extracted_Adj_Record.succ_start[i + 1]; k++) {
+//                blockID adj_block = extracted_Adj_Record.blocks[extracted_Adj_Record.succ[k]];
 //                cout << getBlockName(adj_block) << "[blockID]: " << adj_block << "; ";
 //            }
 //            cout << endl;
@@ -1118,210 +1344,265 @@ bool DFnetlist_Impl::getAdjRecordfromMGs(std::vector<DFnetlist_Impl::subNetlistP
 }
 
 /**
- * @brief Find all simple paths within one Marked Graph (Use vectors to simulate the functionality of a stack);
- * @note For the implemented algorithm, two stacks are needed for the DFS-Backtracking algorithm.
- * Stack_1 for storing the possible path, Stack_2 keeps track of available nodes.
- * Recursive methods are not used as they may overflow for large graphs
+ * @brief Find the path used for the timing info between two blocks of one Marked Graph
  * @param sel_MG A graphAdjrecord with all adjacency lists within one MG
  * @param start_block Block identifier of the specified start block of the path
  * @param end_block Block identifier of the specified end block of the path
- * @param type_selection 
- *                  0. Used to alculate the path for LSQ (select the shortest for each path_index)
- *                  1. Other cases (Still select the shortest path for the given path_index)
+ * @param type_selection
+ *                  0. Used to calculate the path for LSQ (select the longest path, see findLongestPathsinMG)
+ *                  1. Other cases (select the shortest path, see findShortestPathinMG)
  * @param MG_index Identifier of the specified MG
- * @return A mgPathInfo structure with the info of all found paths in the selected MG
+ * @return A mgPathInfo structure with the selected path in the selected MG
  * @date 28/05/2022
  * @author Jiantao Liu
  */
-DFnetlist_Impl::mgPathInfo DFnetlist_Impl::findPathsinMG(DFnetlist_Impl::graphAdjrecord &sel_MG, blockID start_block, blockID end_block, int type_selection, int MG_index) {
+DFnetlist_Impl::mgPathInfo DFnetlist_Impl::findPathsinMG(const DFnetlist_Impl::graphAdjrecord &sel_MG, blockID start_block, blockID end_block, int type_selection, int MG_index) {
     // Formatting output
     cout << endl;
-    // cout << "*********************************************************************************" << endl;
     cout << "Searching for a path from " << getBlockName(start_block) << " to " << getBlockName(end_block) << endl;
     cout << endl;
 
-    // Variable Definitions
-    // Two stacks are needed for the back-tracking algorithm
-    std::vector<int> path_index;
-    std::vector<blockID> Path_Stack_S1; // Main stack for tracking the path
-    std::vector< std::set<blockID> > Adj_Block_S2; // Supporting Stack for recording potential paths
-    mgPathInfo found_paths; // Used to store the found paths in the selected MG
-    std::vector< std::vector<int> > All_found_paths; // Used to store all found paths
-
-    // Supporting Variables
-    int counter = 0;
-    std::set<blockID> adj_list; // Usd to store the adj_list of the selected node
-
-    // Initialize and build the starting point
-    All_found_paths.clear();
-    Path_Stack_S1.clear();
-    Adj_Block_S2.clear();
-    path_index.clear();
-    path_index.push_back(start_block);
-    path_index.push_back(end_block);
-
-    // Initialize stacks
-    Path_Stack_S1.push_back(start_block);
-    Adj_Block_S2.push_back(sel_MG.getAdjList(start_block));
-
-    // Search for the path
-    while (!Path_Stack_S1.empty()) {
-        // Variable Definition
-        blockID tem_block = 0;
-        // Extract the adjacency list of the top element in the main stack, and pop the corresponding element
-        adj_list = Adj_Block_S2.back();
-        Adj_Block_S2.pop_back();
+    if (type_selection == 0) {
+        return findLongestPathsinMG(sel_MG, start_block, vector<blockID>(1, end_block), MG_index);
+    } else {
+        return findShortestPathinMG(sel_MG, start_block, end_block);
+    }
+}
 
-        // Testing
-        // print_main_stack(Path_Stack_S1);
-        // print_adj_stack(Adj_Block_S2);
-
-        // If the adj list is not empty
-        if (adj_list.size() > 0) {
-            // Add the first element of the Adj_list to the main stack
-            // and push back the adj_list without the first element
-            tem_block = *adj_list.begin();
-            adj_list.erase(tem_block);
-            // Push the corresponding node to the Adj stack
-            Path_Stack_S1.push_back(tem_block);
-            Adj_Block_S2.push_back(adj_list);
+/**
+ * @brief Topological order of the blocks of one Marked Graph reachable from the start block.
+ * @note The back edges of the netlist (which include the loopback edges) are cut. Any cycle left is
+ * cut at the edge that closes it in an iterative DFS (visiting the adjacent blocks in ascending order).
+ * @param sel_MG A graphAdjrecord with all adjacency lists within one MG
+ * @param start Local number of the start block
+ * @param order Local numbers of the blocks in topological order (output)
+ * @param in_dag Whether each edge (position in sel_MG.succ) is kept in the acyclic graph (output)
+ */
+void DFnetlist_Impl::orderMGfromBlock(const DFnetlist_Impl::graphAdjrecord &sel_MG, int start,
+                                      std::vector<int> &order, std::vector<char> &in_dag) {
+    int n = sel_MG.numBlock();
+    blockBitset visited, finished;
+    visited.reset(n);
+    finished.reset(n);
+    order.clear();
+    in_dag.assign(sel_MG.succ.size(), 0);
+
+    // Stack of (block, next edge to visit)
+    vector<pair<int, int>> stack;
+    stack.reserve(n);
+    visited.set(start);
+    stack.push_back(make_pair(start, sel_MG.succ_start[start]));
+    while (not stack.empty()) {
+        int b = stack.back().first;
+        int k = stack.back().second++;
+        if (k == sel_MG.succ_start[b + 1]) {
+            finished.set(b);
+            order.push_back(b);
+            stack.pop_back();
+            continue;
+        }
 
-            // Testing
-            // print_main_stack(Path_Stack_S1);
-            // print_adj_stack(Adj_Block_S2);
+        int next = sel_MG.succ[k];
+        if (sel_MG.succ_back[k] or (visited.test(next) and not finished.test(next))) continue;
+        in_dag[k] = 1;
+        if (not visited.test(next)) {
+            visited.set(next);
+            stack.push_back(make_pair(next, sel_MG.succ_start[next]));
+        }
+    }
 
-            // Create new adj_list for the top element in the Main stack
-            std::set<blockID> temp_adj_list;
-            temp_adj_list.clear();
-            adj_list = sel_MG.getAdjList(tem_block);
-            for (auto elem: adj_list) {
-                // Check whether this element is in the main stack
-                if (std::find(Path_Stack_S1.begin(), Path_Stack_S1.end(), elem) == Path_Stack_S1.end()) {
-                    // The elem is not in the main stack
-                    temp_adj_list.insert(elem);
+    reverse(order.begin(), order.end());
+}
 
-                } else {
-                    // The elem is in the main stack
-                    // cout << getBlockName(elem) << " is already in the Main Stack!" << endl;
-                }
-            }
+/**
+ * @brief Latency of one block along a path, as calculated by pathLatency (without the loopback edges).
+ * @param sel_block Block identifier of the block
+ * @param lat_total Latency of the path up to the block (updated)
+ * @param Buffer_flag Whether an opaque buffer precedes the block (updated)
+ */
+void DFnetlist_Impl::blockPathLatency(blockID sel_block, int &lat_total, int &Buffer_flag) {
+    if (getBlockType(sel_block) == ELASTIC_BUFFER) {
+        if (not isBufferTransparent(sel_block)) {
+            Buffer_flag = 1;
+            lat_total += 1;
+        }
+        return;
+    }
 
-            // Push new adj_list to the Adj stack
-            Adj_Block_S2.push_back(temp_adj_list);
+    int latency = getLatency(sel_block);
+    const string& op = getOperation(sel_block);
+    if (op == "lsq_load_op") {
+        if (lat_total >= 2) lat_total += Buffer_flag ? latency : latency - 1;
+        else lat_total = latency + 1;
+        Buffer_flag = 0;
+    } else if (latency > 0) {
+        if (Buffer_flag) {
+            Buffer_flag = 0;
+            if (op == "mul_op") lat_total += 5;
+            else if (op == "mc_load_op") lat_total += 2;
+            else lat_total += latency;
         } else {
-            // The adj_list of the corresponding top elem in the Main stack is empty
-            // Cutdown the stack
-            Path_Stack_S1.pop_back();
+            if (op == "mul_op") lat_total += 4;
+            else if (op == "mc_load_op") lat_total += lat_total == 0 ? 3 : 1;
+            else lat_total += latency - 1;
         }
+    } else {
+        lat_total += latency;
+    }
+}
 
-        // Testing
-        // print_main_stack(Path_Stack_S1);
-        // print_adj_stack(Adj_Block_S2);
-
-        // Found one Path!
-        if (Path_Stack_S1.size() > 0) {
-            if (Path_Stack_S1.back() == end_block) {
-                // ONE Path found!
-                // Save the path
-                All_found_paths.push_back(Path_Stack_S1);
-                // Testing
-//                cout << endl;
-//                cout << "[ONE_PATH_FOUND] Number " << counter << " Path found" << endl;
-//                for (auto insert_block: Path_Stack_S1) {
-//                    cout << "Push " << getBlockName(insert_block) << " to path holder" << endl;
-//                     //found_paths.insertBlock(path_index, insert_block);
-//                }
-
-                // Increase the counter
-                counter++;
-
-                // Testing: print the found path
-//                cout << endl;
-//                cout << "One direct path from " << getBlockName(start_block) << " to " << getBlockName(end_block) << " is found as below: " << endl;
-//                found_paths.print_path(path_index);
-
-                // Cutdown the stack
-                Path_Stack_S1.pop_back();
-                if (Adj_Block_S2.size() > 0) {
-                    Adj_Block_S2.pop_back();
+/**
+ * @brief Find the longest paths (in terms of pathLatency) from one block to some blocks of one Marked Graph
+ * @note Dynamic programming over the topological order of the MG with the back edges cut (see orderMGfromBlock),
+ * linear in the size of the MG. The latency of a path depends on the buffer preceding each block (Buffer_flag),
+ * and it is monotonic with the latency up to each block, except for an mc_load_op at latency 0. Thus, for each
+ * block and Buffer_flag, the DP keeps the path with the maximum latency and a path with latency 0 (if any).
+ * @param sel_MG A graphAdjrecord with all adjacency lists within one MG
+ * @param start_block Block identifier of the specified start block of the paths
+ * @param end_blocks Block identifiers of the end blocks of the paths
+ * @param MG_index Identifier of the specified MG
+ * @return A mgPathInfo structure with the longest path to each of the end blocks
+ */
+DFnetlist_Impl::mgPathInfo DFnetlist_Impl::findLongestPathsinMG(const DFnetlist_Impl::graphAdjrecord &sel_MG, blockID start_block,
+                                                                const std::vector<blockID> &end_blocks, int MG_index) {
+    // State of the DP for one block: index = 2 * Buffer_flag + (0: maximum latency, 1: latency 0)
+    struct pathState {
+        bool valid = false;
+        int latency = 0;
+        int pred = -1;
+        int pred_state = -1;
+    };
+
+    mgPathInfo found_paths;
+    int start = sel_MG.getIndex(start_block);
+    vector<array<pathState, 4>> dp(sel_MG.numBlock());
+
+    // Extends the paths of a state of pred with block b
+    auto extend = [&](int b, int lat_total, int Buffer_flag, int pred, int pred_state) {
+        blockPathLatency(sel_MG.blocks[b], lat_total, Buffer_flag);
+        pathState& max_state = dp[b][2 * Buffer_flag];
+        if (not max_state.valid or lat_total > max_state.latency) {
+            max_state.valid = true;
+            max_state.latency = lat_total;
+            max_state.pred = pred;
+            max_state.pred_state = pred_state;
+        }
+        pathState& zero_state = dp[b][2 * Buffer_flag + 1];
+        if (lat_total == 0 and not zero_state.valid) {
+            zero_state.valid = true;
+            zero_state.pred = pred;
+            zero_state.pred_state = pred_state;
+        }
+    };
+
+    if (start >= 0) {
+        vector<int> order;
+        vector<char> in_dag;
+        orderMGfromBlock(sel_MG, start, order, in_dag);
+
+        extend(start, 0, 0, -1, -1);
+        for (int b: order) {
+            for (int s = 0; s < 4; s++) {
+                const pathState st = dp[b][s];
+                if (not st.valid) continue;
+                for (int k = sel_MG.succ_start[b]; k < sel_MG.succ_start[b + 1]; k++) {
+                    if (in_dag[k]) extend(sel_MG.succ[k], st.latency, s / 2, b, s);
                 }
             }
         }
     }
 
-    // Check the validity of the found paths
-    if (All_found_paths.size() == 0) {
-        // Error
-        cout << endl;
-        cout << "[ERROR] AT LEAST ONE PATH SHALL BE FOUND FOR THE SPECIFIED START END POINT" << endl;
-        return found_paths;
-    }
+    for (blockID end_block: end_blocks) {
+        vector<int> path_index = {start_block, end_block};
+        int end = sel_MG.getIndex(end_block);
 
-    // Check for the shortest path
-    // For load we can directly calculate the shortest path
-    // For store we should consider the data dependency(WAR data hazard) between load and store.
-    //      if we found any load operation in the
-    int min_position = 0;
-    int max_position = 0;
-    int war_dep_flag = 0;
+        int best = -1;
+        for (int s = 0; end >= 0 and s < 4; s++) {
+            const pathState& st = dp[end][s];
+            if (st.valid and (best < 0 or st.latency > dp[end][best].latency)) best = s;
+        }
 
-    if (type_selection == 0) {
-        cout << "==================== Find the Longest Path in all extracted paths ====================" << endl;
-        // Check whether this is a load operation
-        if (getOperation(end_block) == "lsq_load_op") {
-            cout << "[LOAD OP] No need for WAR dependency checking" << endl;
-
-            // Search for the shortest path
-            for (int i = 0; i < All_found_paths.size(); i++) {
-                // Check whether the path has the icmp node or not
-                // if (check_for_icmp_node(All_found_paths[i])) continue;
-
-                if (pathLatency(All_found_paths[i], MG_index) > pathLatency(All_found_paths[max_position], MG_index)) {
-                    max_position = i;
-                }
-            }
-        } else {
-            cout << "[STORE OP] Need to check WAR dependency" << endl;
-            string set_op = "lsq_load_op";
-            vector<int> path_with_load;
-
-            // Search for the shortest path
-            for (int i = 0; i < All_found_paths.size(); i++) {
-                if (pathLatency(All_found_paths[i], MG_index) > pathLatency(All_found_paths[max_position], MG_index)) {
-                    max_position = i;
-                }
-            }
+        if (best < 0) {
+            cout << "[ERROR] AT LEAST ONE PATH SHALL BE FOUND FOR THE SPECIFIED START END POINT: "
+                 << getBlockName(start_block) << " -> " << getBlockName(end_block) << endl;
+            continue;
+        }
+
+        vector<blockID> path;
+        for (int b = end; b >= 0; ) {
+            path.push_back(sel_MG.blocks[b]);
+            const pathState& st = dp[b][best];
+            b = st.pred;
+            best = st.pred_state;
         }
+        reverse(path.begin(), path.end());
 
-        // Set min_index as the same value
-        min_position = max_position;
+        cout << "Longest path from " << getBlockName(start_block) << " to " << getBlockName(end_block) << ":";
+        for (blockID b: path) {
+            cout << " " << getBlockName(b);
+            found_paths.insertBlock(path_index, b);
+        }
+        cout << endl;
+    }
 
+    return found_paths;
+}
 
-    } else {
-        cout << "==================== Find the shortest Path in all extracted paths ====================" << endl;
-        cout << "Selecting the shortest path in all extracted paths" << endl;
-        // Search for the shortest path
-        for (int i = 0; i < All_found_paths.size(); i++) {
-            // Check whether the path has the icmp node or not
-            // if (check_for_icmp_node(All_found_paths[i])) continue;
-
-            if (All_found_paths[i].size() < All_found_paths[min_position].size()) {
-                min_position = i;
-            }
+/**
+ * @brief Find the shortest path (in number of blocks) between two blocks of one Marked Graph
+ * @note BFS from the end block, in linear time. Among the shortest paths, the selected one is the first one
+ * in lexicographic order (the first one found by a DFS visiting the adjacent blocks in ascending order).
+ * @param sel_MG A graphAdjrecord with all adjacency lists within one MG
+ * @param start_block Block identifier of the specified start block of the path
+ * @param end_block Block identifier of the specified end block of the path
+ * @return A mgPathInfo structure with the shortest path
+ */
+DFnetlist_Impl::mgPathInfo DFnetlist_Impl::findShortestPathinMG(const DFnetlist_Impl::graphAdjrecord &sel_MG, blockID start_block, blockID end_block) {
+    mgPathInfo found_paths;
+    vector<int> path_index = {start_block, end_block};
+    int start = sel_MG.getIndex(start_block);
+    int end = sel_MG.getIndex(end_block);
+
+    // Distance of every block to the end block (the queue is the prefix of bfs not visited yet)
+    vector<int> dist(sel_MG.numBlock(), -1);
+    vector<int> bfs;
+    bfs.reserve(sel_MG.numBlock());
+    if (start >= 0 and end >= 0) {
+        dist[end] = 0;
+        bfs.push_back(end);
+    }
+    for (int head = 0; head < bfs.size() and dist[start] < 0; head++) {
+        int b = bfs[head];
+        for (int k = sel_MG.pred_start[b]; k < sel_MG.pred_start[b + 1]; k++) {
+            int p = sel_MG.pred[k];
+            if (dist[p] >= 0) continue;
+            dist[p] = dist[b] + 1;
+            bfs.push_back(p);
         }
     }
 
-    // Store the shortest path
-    for (auto insert_block: All_found_paths[min_position]) {
-        cout << "Push " << getBlockName(insert_block) << " to the final path storing structure" << endl;
-        found_paths.insertBlock(path_index, insert_block);
+    if (start < 0 or dist[start] < 0) {
+        cout << endl;
+        cout << "[ERROR] AT LEAST ONE PATH SHALL BE FOUND FOR THE SPECIFIED START END POINT" << endl;
+        return found_paths;
     }
 
-    cout << "=======================================================================================" << endl;
+    int b = start;
+    found_paths.insertBlock(path_index, start_block);
+    while (b != end) {
+        for (int k = sel_MG.succ_start[b]; k < sel_MG.succ_start[b + 1]; k++) {
+            int next = sel_MG.succ[k];
+            if (dist[next] == dist[b] - 1) {
+                b = next;
+                break;
+            }
+        }
+        found_paths.insertBlock(path_index, sel_MG.blocks[b]);
+    }
 
-    cout << "*********************************************************************************" << endl;
+    cout << "Shortest path from " << getBlockName(start_block) << " to " << getBlockName(end_block)
+         << " with " << dist[start] + 1 << " blocks" << endl;
     return found_paths;
-
 }
 
 // THis function will calculate the latency for the given path
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <graphviz/cgraph.h>
 #include "DFnetlist.h"
+#include "NetlistBinary.h"
 
 using namespace Dataflow;
 using namespace std;
@@ -501,6 +502,8 @@ static bool readLSQParams(DFnetlist_Impl& DF, blockID id, Agnode_t* v)
             }
 
              DF.setLSQDepth(id, t);
+            DF.setLoadQDepth(id, t);
+            DF.setStoreQDepth(id, t);
         }
 
         attr = agget(v, (char *) "numLoads");
@@ -688,6 +691,11 @@ bool DFnetlist_Impl::readDataflowDot(FILE *f)
 
     if (g == nullptr) return false; // No graph has been read.
 
+    return readDataflowGraph(g);
+}
+
+bool DFnetlist_Impl::readDataflowGraph(Agraph_t *g)
+{
     if (not agisdirected(g)) {
         setError("It is not a directed graph.");
         return false;
@@ -856,6 +864,8 @@ bool DFnetlist_Impl::readDataflowDot(FILE *f)
 
 bool DFnetlist_Impl::readDataflowDot(const string& filename)
 {
+    if (NetlistBinary::isBinaryFile(filename)) return readDataflowBinary(filename);
+
     FILE* f = fopen(filename.c_str(), "r");
     if (f == nullptr) {
         setError("File " + filename + " could not be opened.");
@@ -0,0 +1,738 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include "DFnetlist.h"
+
+using namespace Dataflow;
+using namespace std;
+
+/**
+ * @brief Token-level, cycle-accurate simulator of a dataflow netlist.
+ *
+ * Every block has a firing rule that defines the channels from which it
+ * consumes and to which it produces when it fires. Joins, forks, operators
+ * and buffers consume from all their inputs and produce to all their outputs
+ * (the only rule in a marked graph). Merges take the first available input,
+ * muxes take the data input selected by the value of the token at their
+ * selection input, and branches send their token to the output selected by
+ * the decisions of their basic block. Tokens carry a value, which is only
+ * used to propagate the index of the input taken by a control merge to the
+ * muxes of its basic block.
+ *
+ * In each cycle, the valid signals are propagated forward from the stored
+ * tokens (least fixpoint) and the firing conditions backward from the free
+ * slots (greatest fixpoint), so that tokens can cross several combinational
+ * blocks in one cycle and ready can cross full buffers that are emptied in the
+ * same cycle. The channels of a block are chosen when it becomes valid and
+ * they do not change in the rest of the cycle.
+ *
+ * The time advances to the next event (token becoming available or block
+ * leaving its initiation interval) when nothing can fire, so that long
+ * latencies do not cost simulation time.
+ */
+class TokenSimulator
+{
+public:
+
+    enum FiringRule {
+        JOIN,       // Consumes from all the inputs and produces to all the outputs
+        MERGE,      // Consumes from the first available input
+        CMERGE,     // Like MERGE, and produces the index of the input at the selection output
+        MUX,        // Consumes from the selection input and from the data input selected by it
+        BRANCH,     // Consumes from all the inputs and produces to the output selected by the BB decision
+        IDLE        // Produces while the watched channels are empty (no inputs)
+    };
+
+    struct SimBlock {
+        FiringRule rule = JOIN;
+        vector<int> in, out;        // Input and output channels (local indices)
+        vector<int> data;           // MUX: data inputs in port order (-1 if unconnected)
+        int sel = -1;               // Selection input (MUX) or output (CMERGE)
+        int trueOut = -1;           // BRANCH: true output (-1 if unconnected)
+        int falseOut = -1;          // BRANCH: false output (-1 if unconnected)
+        int bb = 0;                 // BRANCH: basic block that provides the decisions
+        int trueBB = -1;            // BRANCH: BB reached by the true output (-1 if unknown)
+        int falseBB = -1;           // BRANCH: BB reached by the false output (-1 if unknown)
+        vector<int> watch;          // IDLE: channels that must be empty
+        int II = 1;                 // Min number of cycles between two firings
+        long long maxFirings = -1;  // Max number of firings (-1: unbounded)
+        long long nextFire = 0;     // Earliest cycle for the next firing
+        long long firings = 0;      // Number of firings
+        vector<int> takes, gives;   // Channels consumed and produced in the current cycle
+        int value = 0;              // Value produced in the current cycle
+    };
+
+    struct SimChannel {
+        int src = -1, dst = -1;     // Source and destination blocks (local indices)
+        int capacity = 0;           // Max number of stored tokens
+        int delay = 0;              // Cycles from the production to the availability of a token
+        deque<long long> tokens;    // Cycle in which each stored token is available (FIFO)
+        deque<int> values;          // Value of each stored token
+        long long headSince = 0;    // Cycle since the head token waits for the consumer
+        long long stalls = 0;       // Cycles in which an available token waited for the consumer
+        bool direct = false;        // Token passed combinationally to the consumer in this cycle
+        bool given = false;         // The producer chose the channel in the current cycle
+        bool taken = false;         // The consumer chose the channel in the current cycle
+        int value = 0;              // Value produced in the current cycle
+    };
+
+    /**
+     * @brief Successors of a basic block and the decisions taken at its end.
+     * The k-th firing of every branch of the BB follows the k-th decision.
+     * A successor is taken as soon as its share of the decisions, according
+     * to the frequencies of the arcs, reaches one more decision, and the most
+     * frequent successor is taken otherwise (e.g., 99 times the back arc and
+     * then once the exit arc for frequencies 99 and 1). Without frequencies,
+     * the first and the second successors are alternated.
+     */
+    struct SimBB {
+        vector<int> succ;           // Successor BBs
+        vector<double> freq;        // Frequency of the arcs to the successors
+        vector<long long> taken;    // Number of decisions for each successor
+        vector<int> decisions;      // Index of the successor of each decision
+
+        int decide(long long k) {
+            while (decisions.size() <= k) decisions.push_back(next());
+            return decisions[k];
+        }
+
+    private:
+        int next() {
+            double total = 0;
+            for (double f: freq) total += f;
+            long long n = decisions.size();
+            if (total <= 0) return n % 2;
+
+            // Successors sorted by increasing frequency
+            vector<int> order(succ.size());
+            for (int i = 0; i < order.size(); ++i) order[i] = i;
+            stable_sort(order.begin(), order.end(), [this](int i, int j) { return freq[i] < freq[j]; });
+
+            int best = order.back();
+            for (int i: order) {
+                if (floor((n + 1) * freq[i] / total + 1e-9) > taken[i]) {
+                    best = i;
+                    break;
+                }
+            }
+            taken[best]++;
+            return best;
+        }
+    };
+
+    vector<SimBlock> blocks;
+    vector<SimChannel> channels;
+    map<int, SimBB> bbs;            // Decisions of the BBs with branches
+    long long now = 0;              // Current cycle
+
+    /**
+     * @brief Adds a token at the beginning of the simulation.
+     * @param c The channel.
+     */
+    void addInitialToken(int c) {
+        channels[c].tokens.push_back(0);
+        channels[c].values.push_back(0);
+    }
+
+    /**
+     * @brief Simulates until a block fires a number of times.
+     * @param ref The reference block.
+     * @param iterations Number of firings of the reference block.
+     * @param maxCycles Max number of simulated cycles.
+     * @param times Cycles in which the reference block fired (output).
+     * @return False if the simulation ends in a deadlock, and true otherwise.
+     */
+    bool run(int ref, int iterations, long long maxCycles, vector<long long>& times) {
+        int nb = blocks.size();
+        valid.assign(nb, false);
+        fire.assign(nb, false);
+
+        while (blocks[ref].firings < iterations and now < maxCycles) {
+            if (cycle()) {
+                if (fire[ref]) times.push_back(now);
+                ++now;
+                continue;
+            }
+
+            // Nothing fired: jump to the next event
+            long long next = LLONG_MAX;
+            for (const SimBlock& B: blocks) {
+                if (B.nextFire > now) next = min(next, B.nextFire);
+            }
+            for (const SimChannel& C: channels) {
+                if (not C.tokens.empty() and C.tokens.front() > now) next = min(next, C.tokens.front());
+            }
+            if (next == LLONG_MAX) return false;
+            now = next;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Adds the waiting time of the tokens that are still in the channels.
+     */
+    void finish() {
+        for (SimChannel& C: channels) {
+            if (not C.tokens.empty() and now > C.headSince) C.stalls += now - C.headSince;
+        }
+    }
+
+private:
+
+    vector<bool> valid;     // The block can fire with the tokens available in the current cycle
+    vector<bool> fire;      // The block fires in the current cycle
+
+    // Availability of a token at the input of the consumer.
+    // Tokens can cross a channel in the same cycle if its delay is zero.
+    bool available(const SimChannel& C, const vector<bool>& producing) const {
+        if (not C.tokens.empty()) return C.tokens.front() <= now;
+        return C.delay == 0 and producing[C.src] and C.given;
+    }
+
+    // Value of the token available at the input of the consumer
+    int value(int c) const {
+        const SimChannel& C = channels[c];
+        return C.values.empty() ? C.value : C.values.front();
+    }
+
+    // The channel can accept a new token in the current cycle
+    bool accepts(const SimChannel& C) const {
+        if (C.tokens.size() < C.capacity) return true;
+        return fire[C.dst] and C.taken and available(C, fire);
+    }
+
+    bool allAvailable(const vector<int>& in, const vector<bool>& producing) const {
+        for (int c: in) {
+            if (not available(channels[c], producing)) return false;
+        }
+        return true;
+    }
+
+    // Direction of a branch in its next firing
+    bool decide(const SimBlock& B) {
+        int i = bbs[B.bb].decide(B.firings);
+        const vector<int>& succ = bbs[B.bb].succ;
+        if (i >= succ.size()) return i == 0;
+        int bb = succ[i];
+        if (bb == B.trueBB) return true;
+        if (bb == B.falseBB) return false;
+        if (B.trueBB >= 0) return false;
+        if (B.falseBB >= 0) return true;
+        return i == 0;
+    }
+
+    /**
+     * @brief Chooses the channels consumed and produced by a block if it
+     * fires in the current cycle, according to its firing rule.
+     * @param b The block.
+     * @param producing Blocks that can produce tokens in the current cycle.
+     * @return True if the block can fire, and false otherwise.
+     */
+    bool choose(int b, const vector<bool>& producing) {
+        SimBlock& B = blocks[b];
+        if (B.nextFire > now) return false;
+        if (B.maxFirings >= 0 and B.firings >= B.maxFirings) return false;
+
+        B.takes.clear();
+        B.gives = B.out;
+        int index = 0;
+
+        switch (B.rule) {
+        case MERGE:
+        case CMERGE:
+            for (int i = 0; i < B.in.size() and B.takes.empty(); ++i) {
+                if (available(channels[B.in[i]], producing)) {
+                    B.takes.push_back(B.in[i]);
+                    index = i;
+                }
+            }
+            if (B.takes.empty()) return false;
+            B.value = value(B.takes[0]);
+            break;
+
+        case MUX: {
+            if (B.sel < 0 or not available(channels[B.sel], producing)) return false;
+            int i = value(B.sel);
+            if (i < 0 or i >= B.data.size() or B.data[i] < 0) return false;
+            if (not available(channels[B.data[i]], producing)) return false;
+            B.takes = {B.sel, B.data[i]};
+            B.value = value(B.data[i]);
+            break;
+        }
+
+        case BRANCH: {
+            if (not allAvailable(B.in, producing)) return false;
+            B.takes = B.in;
+            B.value = B.data.empty() or B.data[0] < 0 ? 0 : value(B.data[0]);
+            int out = decide(B) ? B.trueOut : B.falseOut;
+            B.gives.clear();
+            if (out >= 0) B.gives.push_back(out);
+            break;
+        }
+
+        case IDLE:
+            for (int c: B.watch) {
+                if (not channels[c].tokens.empty()) return false;
+            }
+            B.value = 0;
+            break;
+
+        default:
+            if (not allAvailable(B.in, producing)) return false;
+            B.takes = B.in;
+            B.value = B.in.empty() ? 0 : value(B.in[0]);
+            break;
+        }
+
+        for (int c: B.takes) channels[c].taken = true;
+        for (int c: B.gives) {
+            channels[c].given = true;
+            channels[c].value = B.rule == CMERGE and c == B.sel ? index : B.value;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Simulates one cycle.
+     * @return True if some block fired.
+     */
+    bool cycle() {
+        int nb = blocks.size();
+
+        for (SimChannel& C: channels) C.given = C.taken = false;
+
+        // Valid: least fixpoint from the stored tokens
+        vector<int> work(nb);
+        for (int b = 0; b < nb; ++b) {
+            valid[b] = false;
+            work[b] = nb - 1 - b;
+        }
+        while (not work.empty()) {
+            int b = work.back();
+            work.pop_back();
+            if (valid[b] or not choose(b, valid)) continue;
+            valid[b] = true;
+            for (int c: blocks[b].gives) {
+                if (channels[c].delay == 0) work.push_back(channels[c].dst);
+            }
+        }
+
+        // Fire: greatest fixpoint below valid, removing the blocks that
+        // cannot deliver their tokens or lost their input tokens
+        for (int b = 0; b < nb; ++b) {
+            fire[b] = valid[b];
+            if (valid[b]) work.push_back(b);
+        }
+        while (not work.empty()) {
+            int b = work.back();
+            work.pop_back();
+            if (not fire[b]) continue;
+            bool ok = allAvailable(blocks[b].takes, fire);
+            for (int c: blocks[b].gives) {
+                if (not ok) break;
+                ok = accepts(channels[c]);
+            }
+            if (ok) continue;
+            fire[b] = false;
+            for (int c: blocks[b].takes) work.push_back(channels[c].src);
+            for (int c: blocks[b].gives) work.push_back(channels[c].dst);
+        }
+
+        bool fired = false;
+
+        // Consume the input tokens
+        for (int b = 0; b < nb; ++b) {
+            if (not fire[b]) continue;
+            fired = true;
+            SimBlock& B = blocks[b];
+            B.nextFire = now + B.II;
+            B.firings++;
+            for (int c: B.takes) {
+                SimChannel& C = channels[c];
+                if (C.tokens.empty()) {
+                    C.direct = true;
+                    continue;
+                }
+                C.stalls += now - C.headSince;
+                C.tokens.pop_front();
+                C.values.pop_front();
+                if (not C.tokens.empty()) C.headSince = max(C.tokens.front(), now);
+            }
+        }
+
+        // Produce the output tokens
+        for (int b = 0; b < nb; ++b) {
+            if (not fire[b]) continue;
+            for (int c: blocks[b].gives) {
+                SimChannel& C = channels[c];
+                if (C.direct) {
+                    C.direct = false;
+                    continue;
+                }
+                C.tokens.push_back(now + C.delay);
+                C.values.push_back(C.value);
+                if (C.tokens.size() == 1) C.headSince = now + C.delay;
+            }
+        }
+
+        return fired;
+    }
+};
+
+// Capacity and delay of a channel, given by the pipeline of the source block
+// and the elastic buffer. The buffer is either a block or an annotation of the
+// channel (the channels of a buffer block repeat its attributes when they are
+// read from a dot file, and they must not be counted twice).
+static void setChannelTiming(const DFnetlist_Impl& DF, channelID c, blockID src, int latency, TokenSimulator::SimChannel& C)
+{
+    C.capacity = latency;
+    C.delay = latency;
+    if (DF.getBlockType(src) == ELASTIC_BUFFER) {
+        C.capacity += DF.getBufferSize(src);
+        if (not DF.isBufferTransparent(src)) C.delay++;
+    } else {
+        int slots = DF.getChannelBufferSize(c);
+        C.capacity += slots;
+        if (slots > 0 and not DF.isChannelTransparent(c)) C.delay++;
+    }
+}
+
+bool DFnetlist_Impl::simulateMarkedGraphs(int iterations)
+{
+    if (MG.empty()) {
+        setError("No marked graphs to simulate.");
+        return false;
+    }
+
+    bool status = true;
+
+    cout << "*** Simulation of the marked graphs (" << iterations << " iterations) ***" << endl;
+
+    for (int mg = 0; mg < MG.size(); ++mg) {
+        auto start = chrono::steady_clock::now();
+
+        // Local indices of the blocks and channels of the marked graph
+        map<blockID, int> blockIndex;
+        vector<blockID> blockIDs;
+        for (blockID b: MG[mg].getBlocks()) {
+            blockIndex[b] = blockIDs.size();
+            blockIDs.push_back(b);
+        }
+        vector<channelID> channelIDs(MG[mg].getChannels().begin(), MG[mg].getChannels().end());
+
+        TokenSimulator sim;
+        sim.blocks.resize(blockIDs.size());
+        for (int i = 0; i < blockIDs.size(); ++i) {
+            sim.blocks[i].II = max(1, getInitiationInterval(blockIDs[i]));
+        }
+
+        int nTokens = 0;
+        sim.channels.resize(channelIDs.size());
+        for (int i = 0; i < channelIDs.size(); ++i) {
+            channelID c = channelIDs[i];
+            blockID src = getSrcBlock(c);
+            TokenSimulator::SimChannel& C = sim.channels[i];
+            C.src = blockIndex[src];
+            C.dst = blockIndex[getDstBlock(c)];
+            sim.blocks[C.src].out.push_back(i);
+            sim.blocks[C.dst].in.push_back(i);
+
+            setChannelTiming(*this, c, src, getLatency(src), C);
+
+            // One token per iteration enters through the back edges
+            if (isBackEdge(c)) {
+                sim.addInitialToken(i);
+                nTokens++;
+            }
+        }
+
+        // The first block of the marked graph is used to measure the throughput
+        vector<long long> times;
+        bool ok = nTokens > 0 and sim.run(0, iterations, (long long)iterations * 10000, times);
+        sim.finish();
+
+        auto end = chrono::steady_clock::now();
+        double secs = chrono::duration<double>(end - start).count();
+
+        cout << "MG " << mg << ": " << blockIDs.size() << " blocks, " << channelIDs.size() << " channels, "
+             << nTokens << " tokens, freq = " << MGfreq[mg] << endl;
+
+        if (not ok or times.size() < 2) {
+            cout << "  Deadlock after " << sim.now << " cycles";
+            if (nTokens == 0) cout << " (no back edges in the marked graph)";
+            cout << endl;
+            status = false;
+            continue;
+        }
+
+        // Measure the II in the second half of the simulation (steady state)
+        int first = times.size() / 2;
+        int last = times.size() - 1;
+        if (first == last) first = 0;
+        double II = double(times[last] - times[first]) / (last - first);
+
+        cout << "  Cycles = " << sim.now << ", II = " << II << ", throughput = " << 1.0/II
+             << ", simulation time = " << secs << " s" << endl;
+
+        // Channels sorted by number of stall cycles
+        vector<int> order;
+        for (int i = 0; i < sim.channels.size(); ++i) {
+            if (sim.channels[i].stalls > 0) order.push_back(i);
+        }
+        sort(order.begin(), order.end(), [&sim](int c1, int c2) {
+            return sim.channels[c1].stalls > sim.channels[c2].stalls;
+        });
+        for (int i: order) {
+            cout << "  " << setw(8) << sim.channels[i].stalls << " stall cycles: "
+                 << getChannelName(channelIDs[i]) << endl;
+        }
+    }
+
+    if (not status) setError("Deadlock when simulating the marked graphs.");
+    return status;
+}
+
+bool DFnetlist_Impl::simulateNetlist(long long maxCycles)
+{
+    auto start = chrono::steady_clock::now();
+
+    TokenSimulator sim;
+    map<channelID, int> channelIndex;
+    vector<channelID> channelIDs;
+    ForAllChannels(c) {
+        channelIndex[c] = channelIDs.size();
+        channelIDs.push_back(c);
+    }
+    sim.channels.resize(channelIDs.size());
+
+    // A netlist block can be simulated by several blocks (memory interfaces
+    // and memory operators), each one with its own latency
+    vector<blockID> owner;
+    vector<int> latency;
+    vector<bool> level(channelIDs.size(), false);   // Channel without storage (end of the memory interfaces)
+    int exitBlock = -1;
+
+    auto newBlock = [&](blockID b, int lat) {
+        sim.blocks.emplace_back();
+        sim.blocks.back().II = max(1, getInitiationInterval(b));
+        owner.push_back(b);
+        latency.push_back(lat);
+        return int(sim.blocks.size()) - 1;
+    };
+
+    auto channel = [&](portID p) {
+        channelID c = getConnectedChannel(p);
+        return validChannel(c) ? channelIndex[c] : -1;
+    };
+
+    auto connect = [&](int b, int c, bool input) {
+        if (c < 0) return;
+        if (input) {
+            sim.blocks[b].in.push_back(c);
+            sim.channels[c].dst = b;
+        } else {
+            sim.blocks[b].out.push_back(c);
+            sim.channels[c].src = b;
+        }
+    };
+
+    // BB reached by the tokens of a branch output (-1 if they are discarded)
+    auto targetBB = [&](int c) {
+        for (int i = 0; c >= 0 and i < channelIDs.size(); ++i) {
+            blockID b = getDstBlock(channelIDs[c]);
+            BlockType type = getBlockType(b);
+            if (type == SINK) return -1;
+            if (type != ELASTIC_BUFFER and type != FORK) return (int) getBasicBlock(b);
+            const setPorts& outs = getPorts(b, OUTPUT_PORTS);
+            c = outs.empty() ? -1 : channel(*outs.begin());
+        }
+        return -1;
+    };
+
+    ForAllBlocks(b) {
+        BlockType type = getBlockType(b);
+        vector<portID> ins(getPorts(b, INPUT_PORTS).begin(), getPorts(b, INPUT_PORTS).end());
+        vector<portID> outs(getPorts(b, OUTPUT_PORTS).begin(), getPorts(b, OUTPUT_PORTS).end());
+
+        // Memory interface: one pipeline from each load address to its data,
+        // the other requests are consumed when they arrive, and the end
+        // output is valid while no request is pending
+        if (type == MC or type == LSQ) {
+            map<string, int> loads;
+            vector<int> pending;
+            for (portID p: ins) {
+                int c = channel(p);
+                if (c < 0) continue;
+                pending.push_back(c);
+                const string& suffix = getMemPortSuffix(p);
+                bool loadAddress = suffix.size() > 2 and suffix[1] == 'l' and suffix.back() == 'a';
+                int sb = newBlock(b, loadAddress ? getLatency(b) : 0);
+                if (loadAddress) loads[suffix.substr(0, suffix.size() - 1)] = sb;
+                connect(sb, c, true);
+            }
+            for (portID p: outs) {
+                int c = channel(p);
+                if (c < 0) continue;
+                const string& suffix = getMemPortSuffix(p);
+                auto it = suffix.empty() ? loads.end() : loads.find(suffix.substr(0, suffix.size() - 1));
+                if (suffix.size() > 2 and suffix[1] == 'l' and suffix.back() == 'd' and it != loads.end()) {
+                    connect(it->second, c, false);
+                    continue;
+                }
+                int sb = newBlock(b, 0);
+                if (suffix == "*e") {
+                    sim.blocks[sb].rule = TokenSimulator::IDLE;
+                    sim.blocks[sb].watch = pending;
+                    level[c] = true;
+                } else {
+                    // Requests to other memory interfaces are not simulated
+                    sim.blocks[sb].maxFirings = 0;
+                }
+                connect(sb, c, false);
+            }
+            continue;
+        }
+
+        // Memory operators: independent paths for the address and the data
+        string op = type == OPERATOR ? getOperation(b) : "";
+        if (op == "mc_load_op" or op == "lsq_load_op" or op == "mc_store_op" or op == "lsq_store_op") {
+            for (int i = 0; i < ins.size() or i < outs.size(); ++i) {
+                int sb = newBlock(b, i == 0 ? getLatency(b) : 0);
+                if (i < ins.size()) connect(sb, channel(ins[i]), true);
+                if (i < outs.size()) connect(sb, channel(outs[i]), false);
+            }
+            continue;
+        }
+
+        int sb = newBlock(b, getLatency(b));
+        TokenSimulator::SimBlock& B = sim.blocks[sb];
+        for (portID p: ins) connect(sb, channel(p), true);
+        for (portID p: outs) connect(sb, channel(p), false);
+
+        switch (type) {
+        case MERGE:
+            B.rule = TokenSimulator::MERGE;
+            break;
+
+        case CNTRL_MG:
+            B.rule = TokenSimulator::CMERGE;
+            for (portID p: outs) {
+                if (getPortType(p) == SELECTION_PORT) B.sel = channel(p);
+            }
+            break;
+
+        case MUX:
+            B.rule = TokenSimulator::MUX;
+            for (portID p: ins) {
+                if (getPortType(p) == SELECTION_PORT) B.sel = channel(p);
+                else B.data.push_back(channel(p));
+            }
+            break;
+
+        case BRANCH:
+            B.rule = TokenSimulator::BRANCH;
+            B.bb = getBasicBlock(b);
+            for (portID p: ins) {
+                if (getPortType(p) != SELECTION_PORT) B.data.push_back(channel(p));
+            }
+            for (portID p: outs) {
+                if (getPortType(p) == TRUE_PORT) {
+                    B.trueOut = channel(p);
+                    B.trueBB = targetBB(B.trueOut);
+                } else if (getPortType(p) == FALSE_PORT) {
+                    B.falseOut = channel(p);
+                    B.falseBB = targetBB(B.falseOut);
+                }
+            }
+            break;
+
+        case FUNC_ENTRY:
+            B.maxFirings = 1;
+            break;
+
+        case FUNC_EXIT:
+            if (exitBlock < 0) exitBlock = sb;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (exitBlock < 0) {
+        setError("No exit block in the netlist to simulate.");
+        return false;
+    }
+
+    // Decisions of the BBs, spread according to the frequencies of the BB graph
+    for (const TokenSimulator::SimBlock& B: sim.blocks) {
+        if (B.rule != TokenSimulator::BRANCH or sim.bbs.count(B.bb) > 0) continue;
+        TokenSimulator::SimBB& S = sim.bbs[B.bb];
+        if (B.bb < 1 or B.bb > BBG.numBasicBlocks()) continue;
+        for (bbArcID arc: BBG.successors(B.bb)) {
+            S.succ.push_back(BBG.getDstBB(arc));
+            S.freq.push_back(BBG.getFrequencyArc(arc));
+            S.taken.push_back(0);
+        }
+    }
+
+    for (int i = 0; i < channelIDs.size(); ++i) {
+        TokenSimulator::SimChannel& C = sim.channels[i];
+        if (not level[i]) setChannelTiming(*this, channelIDs[i], owner[C.src], latency[C.src], C);
+    }
+
+    vector<long long> times;
+    bool ok = sim.run(exitBlock, 1, maxCycles, times);
+    sim.finish();
+
+    auto end = chrono::steady_clock::now();
+    double secs = chrono::duration<double>(end - start).count();
+
+    cout << "*** Simulation of the netlist (" << sim.blocks.size() << " blocks, "
+         << sim.channels.size() << " channels) ***" << endl;
+
+    if (times.empty()) {
+        if (ok) cout << "  No exit after " << sim.now << " cycles" << endl;
+        else cout << "  Deadlock after " << sim.now << " cycles" << endl;
+        for (int i = 0; i < sim.channels.size(); ++i) {
+            if (not sim.channels[i].tokens.empty()) {
+                cout << "  " << setw(8) << sim.channels[i].tokens.size() << " tokens in "
+                     << getChannelName(channelIDs[i]) << endl;
+            }
+        }
+        setError(ok ? "The simulation of the netlist did not reach the exit." : "Deadlock when simulating the netlist.");
+        return false;
+    }
+
+    cout << "  Cycles = " << times[0] + 1 << ", simulation time = " << secs << " s" << endl;
+
+    // Executions of the BBs with branches (the profiled frequency in parenthesis)
+    map<int, long long> executions;
+    for (const TokenSimulator::SimBlock& B: sim.blocks) {
+        if (B.rule == TokenSimulator::BRANCH) executions[B.bb] = max(executions[B.bb], B.firings);
+    }
+    for (auto& e: executions) {
+        cout << "  BB" << e.first << ": " << e.second << " executions";
+        if (e.first >= 1 and e.first <= BBG.numBasicBlocks()) cout << " (" << BBG.getFrequency(e.first) << ")";
+        cout << endl;
+    }
+
+    // Channels sorted by number of stall cycles
+    vector<int> order;
+    for (int i = 0; i < sim.channels.size(); ++i) {
+        if (sim.channels[i].stalls > 0) order.push_back(i);
+    }
+    sort(order.begin(), order.end(), [&sim](int c1, int c2) {
+        return sim.channels[c1].stalls > sim.channels[c2].stalls;
+    });
+    for (int i: order) {
+        cout << "  " << setw(8) << sim.channels[i].stalls << " stall cycles: "
+             << getChannelName(channelIDs[i]) << endl;
+    }
+
+    return true;
+}
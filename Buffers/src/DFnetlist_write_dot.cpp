@@ -402,6 +402,11 @@ void DFnetlist_Impl::writeBlockDot(ostream& s, blockID b)
     if (B.type == LSQ) {
 
         s << ", fifoDepth = " << getLSQDepth(b);
+        // Jiantao: 23/03/22 Separate Load & Store Queue depth (only if sized separately)
+        if (getLoadQDepth(b) != getLSQDepth(b) or getStoreQDepth(b) != getLSQDepth(b)) {
+            s << ", fifoDepth_L = " << getLoadQDepth(b);
+            s << ", fifoDepth_S = " << getStoreQDepth(b);
+        }
         s << ", numLoads = \"" << getNumLoads(b) << "\"";
         s << ", numStores = \"" << getNumStores(b) << "\"";
         s << ", loadOffsets = \"" << getLoadOffsets(b) << "\"";
@@ -404,6 +404,10 @@ bool DFnetlist::writeDotBB(std::ostream &s) {
     return DFI->writeDotBB(s);
 }
 
+bool DFnetlist::writeBinary(const std::string &filename) {
+    return DFI->writeBinary(filename);
+}
+
 bool DFnetlist::writeBasicBlockDot(const string& filename)
 {
     return DFI->writeBasicBlockDot(filename);
@@ -414,6 +418,34 @@ bool DFnetlist::writeBasicBlockDot(std::ostream& s)
     return DFI->writeBasicBlockDot(s);
 }
 
+// Jiantao, Overall flow for LSQ parameter exploration
+bool DFnetlist::buildAdjMatrix(double coverage, std::string& dot_name, DFnetlist& out_netlist, int selected_case)
+{
+    return DFI->buildAdjMatrix(coverage, dot_name, out_netlist, selected_case);
+}
+
+bool DFnetlist::batchLSQSizing(double coverage, const std::string& dot_name, const std::vector<int>& cases)
+{
+    return DFI->batchLSQSizing(coverage, dot_name, cases);
+}
+
+bool DFnetlist::benchmarkPathSearch(double coverage, int iterations)
+{
+    return DFI->benchmarkPathSearch(coverage, iterations);
+}
+
+// Jiantao, 13/06/2022
+bool DFnetlist::setSPLSQparams(blockID lsq_block_id, int load_depth, int store_depth)
+{
+    return DFI->setSPLSQparams(lsq_block_id, load_depth, store_depth);
+}
+
+// Jiantao, 13/06/2022
+bool DFnetlist::changeOutDot(const std::string& LSQ_node_name, int optimal_load_depth, int optimal_store_depth)
+{
+    return DFI->changeOutDot(LSQ_node_name, optimal_load_depth, optimal_store_depth);
+}
+
 void DFnetlist::reduceMerges(){ //Carmine 09.03.22 function to eliminate the merges with 1 input - they reduce to wire
     return DFI->reduceMerges();
 }
@@ -423,6 +455,21 @@ void DFnetlist::setMilpSolver(const string& solver)
     return DFI->setMilpSolver(solver);
 }
 
+void DFnetlist::setMilpThreads(int threads)
+{
+    return DFI->setMilpThreads(threads);
+}
+
+void DFnetlist::setBufferCache(const std::string& dir)
+{
+    return DFI->setBufferCache(dir);
+}
+
+void DFnetlist::setWriteDelays(bool write)
+{
+    return DFI->setWriteDelays(write);
+}
+
 bool DFnetlist::addElasticBuffers(double Period, double BufferDelay, bool maxThroughput, double coverage)
 {
     return DFI->addElasticBuffers(Period, BufferDelay, maxThroughput, coverage);
@@ -433,6 +480,21 @@ bool DFnetlist::addElasticBuffersBB_sc(double Period, double BufferDelay, bool m
     return DFI->addElasticBuffersBB_sc(Period, BufferDelay, maxThroughput, coverage, timeout, first_MG, model_mode, lib_path);
 }
 
+bool DFnetlist::simulateMarkedGraphs(int iterations)
+{
+    return DFI->simulateMarkedGraphs(iterations);
+}
+
+bool DFnetlist::simulateNetlist(long long maxCycles)
+{
+    return DFI->simulateNetlist(maxCycles);
+}
+
+const std::map<int, double>& DFnetlist::getMGThroughputs() const
+{
+    return DFI->getMGThroughputs();
+}
+
 bool DFnetlist::addElasticBuffersBB(double Period, double BufferDelay, bool maxThroughput, double coverage, int timeout, bool first_MG)
 {
     return DFI->addElasticBuffersBB(Period, BufferDelay, maxThroughput, coverage, timeout, first_MG);
@@ -2,6 +2,7 @@
 #define DATAFLOW_H
 
 #include <list>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -129,6 +130,27 @@ public:
      */
     void setMilpSolver(const std::string& solver = "cbc");
 
+    /**
+     * @brief Sets the maximum number of MILP models of disjoint marked graphs
+     * that are built and solved concurrently.
+     * @param threads Number of worker threads (1 means sequential solving).
+     */
+    void setMilpThreads(int threads = 1);
+
+    /**
+     * @brief Sets the directory of the buffer cache, where the buffer placement
+     * of every disjoint marked graph is stored and reused by later runs.
+     * @param dir Path of the directory (empty to disable the cache).
+     */
+    void setBufferCache(const std::string& dir = "");
+
+    /**
+     * @brief Sets whether buffer placement writes the timing of the blocks
+     * (delays_output.txt and tmp_delays.txt in the working directory).
+     * @param write True to write the files.
+     */
+    void setWriteDelays(bool write = true);
+
     /**
      * @brief Checks that the netlist is well-formed.
      * @return True if it is well-formed and false otherwise.
@@ -637,6 +659,14 @@ public:
     bool writeDotBB(std::ostream& s);
     bool writeDotBB(const std::string& filename = "");
 
+    /**
+     * @brief Writes the dataflow netlist in the binary format (see NetlistBinary.h).
+     * The netlist can be read back from it as from the dot file.
+     * @param filename The name of the file.
+     * @return True if successful, and false otherwise.
+     */
+    bool writeBinary(const std::string& filename);
+
     /**
      * @brief Writes the Basic Blocks of the dataflow netlist in dot format.
      * @param filename The name of the file. In case the filename is empty,
@@ -652,6 +682,52 @@ public:
      */
     bool writeBasicBlockDot(std::ostream& s);
 
+    /**
+     * @brief Extract path info from the extracted MGs and size the load and
+     * store queues (lsq_sizing flow). This function can only be executed on
+     * a netlist with buffers (after addElasticBuffers(), addElasticBuffersBB()
+     * or addElasticBuffersBB_sc()).
+     * @return True if successful, and false otherwise.
+     */
+    // Jiantao 03/05/2022
+    bool buildAdjMatrix(double coverage, std::string& dot_name, DFnetlist& out_netlist, int selected_case);
+
+    /**
+     * @brief lsq_sizing flow for several cases in one run. The MGs and their
+     * paths are extracted once, and the depths of the LSQ are calculated for
+     * the throughput file of every case (see buildAdjMatrix). The table with
+     * the depths of every case is printed and written in <dot_name>_lsq_depths.txt.
+     * @param coverage Desired coverage for MG calculation.
+     * @param dot_name Name of the dot file after buffers flow.
+     * @param cases Cases to calculate (0: best, 1: worst, 2: variable throughput).
+     * @return True if the depths of all the cases have been calculated, and false otherwise.
+     */
+    bool batchLSQSizing(double coverage, const std::string& dot_name, const std::vector<int>& cases);
+
+    /**
+     * @brief Micro-benchmark of the traversals of the lsq_sizing flow (adjacency
+     * records of the MGs, LSQ nodes, loopback edges and path searches). The
+     * stages are run several times and their average time is reported.
+     * @param coverage Desired coverage for MG calculation.
+     * @param iterations Number of times each stage is run.
+     * @return True if successful, and false otherwise.
+     */
+    bool benchmarkPathSearch(double coverage, int iterations);
+
+    /**
+     * @brief Set the depth for the store queue and load queue separately
+     * @return True if successful, and false otherwise.
+     */
+    // Jiantao, 03/06/2022
+    bool setSPLSQparams(blockID lsq_block_id, int load_depth, int store_depth);
+
+    /**
+     * @brief Change the output dot file correspondingly
+     * @return True if successful, and false otherwise.
+     */
+    // Jiantao, 03/06/2022
+    bool changeOutDot(const std::string& LSQ_node_name, int optimal_load_depth, int optimal_store_depth);
+
     /**
      * @brief Adds elastic buffers to meet a certain cycle period and
      * have elasticity in the system.
@@ -666,6 +742,36 @@ public:
 
     bool addElasticBuffersBB_sc(double Period = 0, double BufferDelay = 0, bool maxThroughput = false, double coverage = 0, int timeout = -1, bool first_MG = false, const std::string& model_mode = "default", const std::string& lib_path="");
 
+    /**
+     * @brief Simulates the extracted marked graphs (CFDFCs) at token level, cycle
+     * by cycle, taking into account the elastic buffers of the channels and the
+     * latency and initiation interval of the blocks. One token per iteration
+     * enters each marked graph through its back edges. It reports the measured
+     * II of each marked graph and the stall cycles of its channels.
+     * @param iterations Number of iterations simulated for each marked graph.
+     * @return True if successful, and false if some marked graph deadlocks.
+     */
+    bool simulateMarkedGraphs(int iterations = 1000);
+
+    /**
+     * @brief Simulates one execution of the netlist at token level, cycle by
+     * cycle, from the firing of the entry blocks to the firing of the exit
+     * block. Merges, muxes and branches follow their own firing rules, and the
+     * branches of each BB follow the frequencies of the BB graph (alternating
+     * the successors if there are no frequencies). It reports the cycles, the
+     * executions of the BBs and the stall cycles of the channels.
+     * @param maxCycles Max number of simulated cycles.
+     * @return True if successful, and false if the exit is not reached.
+     */
+    bool simulateNetlist(long long maxCycles = 100000000);
+
+    /**
+     * @brief Returns the throughput achieved by each CFDFC (sub marked graph) in the
+     * last buffer placement with throughput maximization (addElasticBuffersBB_sc).
+     * @return A map from the CFDFC index to its throughput (empty if not computed).
+     */
+    const std::map<int, double>& getMGThroughputs() const;
+
     /**
      * @brief Creates buffers for all those channels annotated with buffers.
      * The information in the channels is deleted.
@@ -826,5 +932,24 @@ public:
     const DFnetlist& operator[](funcID id) const;
 };
 
+/**
+ * @brief Converts a dot file into the binary format (see NetlistBinary.h),
+ * keeping all the attributes of the graph, nodes and edges.
+ * @param dotfile Name of the dot file.
+ * @param binfile Name of the binary file.
+ * @param error Error message in case of failure.
+ * @return True if successful, and false otherwise.
+ */
+bool convertDotToBinary(const std::string& dotfile, const std::string& binfile, std::string& error);
+
+/**
+ * @brief Converts a binary file into dot format (for debugging).
+ * @param binfile Name of the binary file.
+ * @param dotfile Name of the dot file.
+ * @param error Error message in case of failure.
+ * @return True if successful, and false otherwise.
+ */
+bool convertBinaryToDot(const std::string& binfile, const std::string& dotfile, std::string& error);
+
 }
 #endif // DATAFLOW_H
@@ -0,0 +1,133 @@
+#ifndef MILP_BACKEND_H
+#define MILP_BACKEND_H
+
+#include <cfloat>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef MILP_CBC_LIB
+#include "Cbc_C_Interface.h"
+#endif
+
+using namespace std;
+
+/**
+ * @class Milp_Matrix
+ * @file MILP_Backend.h
+ * @brief In-memory representation of an MILP model that is passed to the solvers
+ * linked as a library. The constraint matrix is stored by columns (CSC format):
+ * the non-zeros of column j are index/value[start[j]..start[j+1]).
+ * Infinite bounds are represented with +/-DBL_MAX.
+ */
+struct Milp_Matrix {
+    int numRows = 0;            /// Number of rows (constraints)
+    int numCols = 0;            /// Number of columns (variables)
+    vector<int> start;          /// Start of every column in index/value (numCols+1 entries)
+    vector<int> index;          /// Row index of every non-zero
+    vector<double> value;       /// Coefficient of every non-zero
+    vector<double> colLower;    /// Lower bound of every column
+    vector<double> colUpper;    /// Upper bound of every column
+    vector<double> obj;         /// Cost of every column
+    vector<double> rowLower;    /// Lower bound of every row
+    vector<double> rowUpper;    /// Upper bound of every row
+    vector<bool> isInteger;     /// Integrality of every column
+    bool minimize = true;       /// Minimization (true) or maximization (false)
+};
+
+/**
+ * @class Milp_Backend
+ * @file MILP_Backend.h
+ * @brief Interface of the MILP solvers linked as a library. The model is
+ * received in memory, so that no file or process is created to solve it.
+ * New solvers are plugged in by implementing this class and registering
+ * them in newMilpBackend.
+ */
+class Milp_Backend
+{
+public:
+
+    enum Result {OPTIMAL, FEASIBLE, INFEASIBLE, UNBOUNDED, NO_SOLUTION};
+
+    virtual ~Milp_Backend() {}
+
+    /**
+     * @brief Solves an MILP model.
+     * @param M The model.
+     * @param start Initial solution for the columns (warm start). Ignored if empty.
+     * @param timelimit Time limit in seconds. No limit if <= 0.
+     * @param solution Value of the columns (only if a solution is found).
+     * @return The result of the optimization.
+     */
+    virtual Result solve(const Milp_Matrix& M, const vector<double>& start, int timelimit, vector<double>& solution) = 0;
+};
+
+#ifdef MILP_CBC_LIB
+/**
+ * @class Milp_CbcBackend
+ * @file MILP_Backend.h
+ * @brief COIN-OR Cbc solver called through its C interface.
+ */
+class Milp_CbcBackend: public Milp_Backend
+{
+public:
+
+    Result solve(const Milp_Matrix& M, const vector<double>& start, int timelimit, vector<double>& solution) override {
+        Cbc_Model* model = Cbc_newModel();
+        Cbc_loadProblem(model, M.numCols, M.numRows, M.start.data(), M.index.data(), M.value.data(),
+                        M.colLower.data(), M.colUpper.data(), M.obj.data(),
+                        M.rowLower.data(), M.rowUpper.data());
+        for (int j = 0; j < M.numCols; ++j) {
+            if (M.isInteger[j]) Cbc_setInteger(model, j);
+        }
+        Cbc_setObjSense(model, M.minimize ? 1 : -1);
+        Cbc_setLogLevel(model, 0);
+        if (timelimit > 0) Cbc_setMaximumSeconds(model, timelimit);
+        if (not start.empty()) {
+            vector<int> cols(M.numCols);
+            for (int j = 0; j < M.numCols; ++j) cols[j] = j;
+            Cbc_setMIPStartI(model, M.numCols, cols.data(), start.data());
+        }
+
+        Cbc_solve(model);
+
+        Result res;
+        if (Cbc_isProvenOptimal(model)) res = OPTIMAL;
+        else if (Cbc_isProvenInfeasible(model)) res = INFEASIBLE;
+        else if (Cbc_isContinuousUnbounded(model)) res = UNBOUNDED;
+        else if (Cbc_bestSolution(model) != nullptr) res = FEASIBLE;
+        else res = NO_SOLUTION;
+
+        if (res == OPTIMAL or res == FEASIBLE) {
+            const double* x = Cbc_getColSolution(model);
+            solution.assign(x, x + M.numCols);
+        }
+
+        Cbc_deleteModel(model);
+        return res;
+    }
+};
+#endif
+
+/**
+ * @brief Creates the backend of a solver linked as a library.
+ * @param name Name of the solver.
+ * @return The backend, or null if the solver is not linked in the binary.
+ */
+inline unique_ptr<Milp_Backend> newMilpBackend(const string& name) {
+#ifdef MILP_CBC_LIB
+    if (name == "cbc_lib") return unique_ptr<Milp_Backend>(new Milp_CbcBackend());
+#endif
+    return nullptr;
+}
+
+/**
+ * @brief Checks whether a solver is linked as a library in the binary.
+ * @param name Name of the solver.
+ * @return True if the solver can be called in-process.
+ */
+inline bool hasMilpBackend(const string& name) {
+    return newMilpBackend(name) != nullptr;
+}
+
+#endif // MILP_BACKEND_H
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <iostream>
 #include <map>
 #include <sstream>
 #include <string>
@@ -12,6 +13,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <regex>
+#include "MILP_Backend.h"
 
 using namespace std;
 
@@ -194,6 +196,7 @@ public:
         else if (type == '=') t = EQ;
         else assert(false);
         Matrix.push_back(Row {name, t, rhs});
+        matrixValid = normalized = false;
         return Matrix.size() - 1;
     }
 
@@ -225,6 +228,7 @@ public:
         assert (rowIndex >= 0 and rowIndex < Matrix.size() and
                 varIndex >= 0 and varIndex < Vars.size());
         Matrix[rowIndex].vecRow.push_back( {coeff, varIndex});
+        matrixValid = normalized = false;
     }
 
     /**
@@ -235,6 +239,40 @@ public:
     void setRHS(int rowIndex, double rhs) {
         assert (rowIndex >= 0 and rowIndex < Matrix.size());
         Matrix[rowIndex].rhs = rhs;
+
+        // Keep the in-memory matrix up to date (no need to rebuild it)
+        int r = matrixValid ? matrixRow[rowIndex] : -1;
+        if (r >= 0) {
+            RowType type = Matrix[rowIndex].type;
+            matrix.rowLower[r] = type == LEQ ? -DBL_MAX : rhs;
+            matrix.rowUpper[r] = type == GEQ ? DBL_MAX : rhs;
+        }
+    }
+
+    /**
+     * @brief Defines the bounds of a variable.
+     * @param varIndex Index of the variable.
+     * @param lower_bound Lower bound.
+     * @param upper_bound Upper bound (unbounded if upper_bound < lower_bound).
+     */
+    void setBounds(int varIndex, double lower_bound, double upper_bound) {
+        assert (varIndex >= 0 and varIndex < Vars.size());
+        Var& v = Vars[varIndex];
+        v.lower_bound = lower_bound;
+        v.upper_bound = upper_bound;
+        if (matrixValid) setMatrixBounds(varIndex);
+    }
+
+    /**
+     * @brief Indicates whether the solution of the previous call to solve
+     * is used as initial solution of the next one (warm start). This is useful
+     * when the model is solved again after modifying some bounds or RHSs.
+     * @param enable True to enable the warm start.
+     * @note The warm start is only passed to the solvers that support it
+     * (solvers linked as a library and gurobi_cl).
+     */
+    void setWarmStart(bool enable = true) {
+        warmStart = enable;
     }
 
     /**
@@ -344,6 +382,7 @@ public:
     void newCostTerm(double coeff, int varIndex) {
         assert (varIndex >= 0 and varIndex < Vars.size());
         Cost.push_back( {coeff, varIndex});
+        matrixValid = normalized = false;
     }
 
     /**
@@ -370,6 +409,9 @@ public:
      */
     bool solve(int timelimit = -1) {
 
+        // Solvers linked as a library receive the model in memory
+        if (hasMilpBackend(solver)) return solveInProcess(timelimit);
+
         if (solver != "cbc" and solver != "glpsol" and solver != "gurobi_cl") { //Carmine 25.02.22 gurobi_cl included as MILP solver
             setError("Unkonwn solver " + solver + ".");
             return false;
@@ -388,13 +430,19 @@ public:
             outfile = createTempFilename("MILP_solution", ".sol");
         else
             outfile = createTempFilename("MILP_solution", ".gsol");
-        string command = writeCommand(solver, lpfile, outfile, timelimit) + " >/dev/null 2>&1";
+        string startfile;
+        if (warmStart and hasSolution and solver == "gurobi_cl") {
+            startfile = createTempFilename("MILP_start", ".mst");
+            writeStart(startfile);
+        }
+        string command = writeCommand(solver, lpfile, outfile, timelimit, startfile) + " >/dev/null 2>&1";
         writeLP(lpfile);
 
         int status = system(command.c_str());
 
         if (status != 0) {
             deleteTempFilename(outfile);
+            if (not startfile.empty()) deleteTempFilename(startfile);
             setError("Error when executing " + solver + ".");
             return false;
         }
@@ -406,6 +454,8 @@ public:
 
         if(!opt_status)
             cout << "*ERROR* MILP solution is UNFEASIBLE or UNBOUNDED" << endl;
+        else hasSolution = true;
+        if (not startfile.empty()) deleteTempFilename(startfile);
 
         //deleteTempFilename(lpfile);
         //deleteTempFilename(outfile);
@@ -423,6 +473,10 @@ public:
         numRealVars=numIntegerVars=numBooleanVars=0;
         numEmptyRows = 0;
         numUsedVars = 0;
+        normalized = matrixValid = false;
+        warmStart = hasSolution = false;
+        matrix = Milp_Matrix();
+        matrixRow.clear();
         stat=UNKNOWN;
         errorMsg = "";
         Cost.clear();
@@ -498,14 +552,35 @@ private:
 
     map<int, string> Name2delays; //Carmine 07.02.2022 map containing the output delay of the blocks
 
+    bool normalized;            /// The terms of the model are normalized
+    Milp_Matrix matrix;         /// In-memory model passed to the solvers linked as a library
+    bool matrixValid;           /// The in-memory model reflects the current model
+    vector<int> matrixRow;      /// Row of the in-memory model for every constraint (-1 if empty)
+    bool warmStart;             /// Use the previous solution as initial solution
+    bool hasSolution;           /// The values of the variables come from a solution
+
     bool find_solver(const string& s) {
 
-        if (not s.empty() and s != "cbc" and s != "glpsol" and s != "gurobi_cl") { //Carmine 25.02.22 gurobi_cl included as MILP solver
+        if (not s.empty() and s != "cbc_lib" and s != "cbc" and s != "glpsol" and s != "gurobi_cl") { //Carmine 25.02.22 gurobi_cl included as MILP solver
             setError("Unkonwn solver " + solver + ".");
             return false;
         }
-        
-        // First try cbc
+
+        // First try the solvers linked as a library (no files nor processes)
+        if (s.empty() or s == "cbc_lib") {
+            if (hasMilpBackend("cbc_lib")) {
+                solver = "cbc_lib";
+                return true;
+            }
+
+            // Fall back to the solvers executed through files
+            if (s == "cbc_lib") {
+                cerr << "MILP solver cbc_lib is not linked in this binary. Trying file-based solvers." << endl;
+                return find_solver("");
+            }
+        }
+
+        // Next try cbc
         if (s.empty() or s == "cbc") {
             string exec = "which cbc >/dev/null 2>&1";
             if (system(exec.c_str()) == 0) {
@@ -568,6 +643,7 @@ private:
         }
         Name2Var[n] = Vars.size();
         Vars.push_back(Var {n, type, lower_bound, upper_bound, 0});
+        matrixValid = false;
         if (type == REAL) numRealVars++;
         else if (type == INTEGER) numIntegerVars++;
         else numBooleanVars++;
@@ -592,8 +668,10 @@ private:
      * the same variable and remove terms with zero coefficient.
      */
     void normalize() {
+        if (normalized) return;
         normalizeRow(Cost);
         for (Row& r: Matrix) normalizeRow(r.vecRow);
+        normalized = true;
     }
 
     /**
@@ -641,14 +719,7 @@ private:
         else if (coeff < 0) f << '-';
         int idx = terms[0].second;
         f << Vars[idx].name;
-        if (not appeared[idx]) {
-            appearanceOrder.push_back(idx);
-            appeared[idx] = true;
-            regex regexp ("timePath_(.)+_out[0-9]+");  //Carmine 07.02.2022 Extracting timing output pins indexes
-            if (regex_search(Vars[idx].name, regexp)){
-                newOutDelay(idx, Vars[idx].name);
-            }
-        }
+        markAppeared(idx);
 
         for (unsigned int i = 1; i < terms.size(); ++i) {
             coeff = terms[i].first;
@@ -656,15 +727,160 @@ private:
             if (abs(coeff) != 1) f << abs(coeff) << ' ';
             idx = terms[i].second;
             f << Vars[idx].name;
-            if (not appeared[idx]) {
-                appearanceOrder.push_back(idx);
-                appeared[idx] = true;
-                regex regexp ("timePath_(.)+_out[0-9]+");  //Carmine 07.02.2022 Extracting timing output pins indexes
-                if (regex_search(Vars[idx].name, regexp)){
-                    newOutDelay(idx, Vars[idx].name);
+            markAppeared(idx);
+        }
+    }
+
+    /**
+     * @brief Registers the first appearance of a variable in the model.
+     * @param idx Index of the variable.
+     */
+    void markAppeared(int idx) {
+        if (appeared[idx]) return;
+        appearanceOrder.push_back(idx);
+        appeared[idx] = true;
+        static const regex regexp ("timePath_(.)+_out[0-9]+");  //Carmine 07.02.2022 Extracting timing output pins indexes
+        if (regex_search(Vars[idx].name, regexp)){
+            newOutDelay(idx, Vars[idx].name);
+        }
+    }
+
+    /**
+     * @brief Builds the in-memory (column-wise) representation of the model.
+     * The bounds follow the semantics of the LP files: variables without
+     * bounds are non-negative and empty rows are ignored.
+     * @param M The matrix that receives the model.
+     */
+    void buildMatrix(Milp_Matrix& M) {
+        normalize();
+        appearanceOrder.clear();
+        appeared = vector<bool>(Vars.size(), false);
+        numEmptyRows = 0;
+
+        int ncols = Vars.size();
+        M = Milp_Matrix();
+        matrixRow.assign(Matrix.size(), -1);
+        M.numCols = ncols;
+        M.minimize = MinMax;
+        M.obj.assign(ncols, 0.0);
+        for (const Term& t: Cost) {
+            M.obj[t.second] += t.first;
+            markAppeared(t.second);
+        }
+
+        // Count the non-zeros of every column
+        vector<int> count(ncols, 0);
+        for (int i = 0; i < Matrix.size(); ++i) {
+            const Row& r = Matrix[i];
+            if (r.vecRow.empty()) {
+                ++numEmptyRows;
+                continue;
             }
+            matrixRow[i] = M.rowLower.size();
+            for (const Term& t: r.vecRow) ++count[t.second];
+            double lower = r.type == LEQ ? -DBL_MAX : r.rhs;
+            double upper = r.type == GEQ ? DBL_MAX : r.rhs;
+            M.rowLower.push_back(lower);
+            M.rowUpper.push_back(upper);
+        }
+        M.numRows = M.rowLower.size();
+
+        M.start.assign(ncols + 1, 0);
+        for (int j = 0; j < ncols; ++j) M.start[j + 1] = M.start[j] + count[j];
+        M.index.resize(M.start[ncols]);
+        M.value.resize(M.start[ncols]);
+
+        vector<int> next(M.start.begin(), M.start.end() - 1);
+        int row = 0;
+        for (const Row& r: Matrix) {
+            if (r.vecRow.empty()) continue;
+            for (const Term& t: r.vecRow) {
+                int k = next[t.second]++;
+                M.index[k] = row;
+                M.value[k] = t.first;
+                markAppeared(t.second);
             }
+            ++row;
         }
+
+        numUsedVars = appearanceOrder.size();
+
+        M.colLower.resize(ncols);
+        M.colUpper.resize(ncols);
+        M.isInteger.resize(ncols);
+        for (int j = 0; j < ncols; ++j) {
+            setMatrixBounds(j, M);
+            M.isInteger[j] = Vars[j].type != REAL;
+        }
+    }
+
+    /**
+     * @brief Copies the bounds of a variable into the in-memory model.
+     * @param j Index of the variable.
+     */
+    void setMatrixBounds(int j) {
+        setMatrixBounds(j, matrix);
+    }
+
+    void setMatrixBounds(int j, Milp_Matrix& M) {
+        const Var& v = Vars[j];
+        bool bounded = v.type == BOOLEAN or v.lower_bound <= v.upper_bound;
+        M.colLower[j] = bounded ? v.lower_bound : 0.0;
+        M.colUpper[j] = bounded ? v.upper_bound : DBL_MAX;
+    }
+
+    /**
+     * @brief Solves the model with a solver linked as a library.
+     * @param timelimit Time limit in seconds. No limit if <= 0.
+     * @return True if successful, and false otherwise.
+     */
+    bool solveInProcess(int timelimit) {
+        unique_ptr<Milp_Backend> backend = newMilpBackend(solver);
+        assert(backend != nullptr);
+
+        // The matrix is only rebuilt after structural changes of the model
+        if (not matrixValid) {
+            buildMatrix(matrix);
+            matrixValid = true;
+        }
+        const Milp_Matrix& M = matrix;
+        matrix.minimize = MinMax;
+
+        vector<double> start;
+        if (warmStart and hasSolution) {
+            for (const Var& v: Vars) start.push_back(v.value);
+        }
+
+        vector<double> solution;
+        switch (backend->solve(M, start, timelimit, solution)) {
+        case Milp_Backend::OPTIMAL:
+            stat = OPTIMAL;
+            break;
+        case Milp_Backend::FEASIBLE:
+            stat = NONOPTIMAL;
+            break;
+        case Milp_Backend::INFEASIBLE:
+            stat = UNFEASIBLE;
+            break;
+        case Milp_Backend::UNBOUNDED:
+            stat = UNBOUNDED;
+            break;
+        default:
+            stat = UNKNOWN;
+        }
+
+        if (stat != OPTIMAL and stat != NONOPTIMAL) {
+            cout << "*ERROR* MILP solution is UNFEASIBLE or UNBOUNDED" << endl;
+            return true;
+        }
+
+        obj = 0;
+        for (int j = 0; j < M.numCols; ++j) {
+            Vars[j].value = solution[j];
+            obj += M.obj[j] * solution[j];
+        }
+        hasSolution = true;
+        return true;
     }
 
     /**
@@ -692,6 +908,7 @@ private:
      */
     void writeLP(ofstream& f) {
         normalize();
+        numEmptyRows = 0;
         appearanceOrder.clear();
         appeared = vector<bool>(Vars.size(), false);
 
@@ -710,35 +927,44 @@ private:
         numUsedVars = 0;
         for (bool b: appeared) if (b) ++numUsedVars;
 
+        // Boolean variables with tighter bounds than [0,1] (e.g., fixed to 0)
+        // are written as bounded integers, since the Binary section resets
+        // the bounds of its variables in some solvers.
+        auto tightBoolean = [](const Var& v) {
+            return v.type == BOOLEAN and v.lower_bound <= v.upper_bound
+                   and (v.lower_bound > 0 or v.upper_bound < 1);
+        };
+
         bool need_bounds = false;
+        bool need_general = numIntegerVars > 0;
+        bool need_binary = false;
         for (const Var& v: Vars) {
-            if (v.type != BOOLEAN and v.lower_bound <= v.upper_bound) {
-                need_bounds = true;
-                break;
-            }
+            if ((v.type != BOOLEAN or tightBoolean(v)) and v.lower_bound <= v.upper_bound) need_bounds = true;
+            if (tightBoolean(v)) need_general = true;
+            else if (v.type == BOOLEAN) need_binary = true;
         }
 
         if (need_bounds) {
             f << "Bounds" << endl;
             for (const Var& v: Vars) {
-                if (v.type != BOOLEAN and v.lower_bound <= v.upper_bound) {
+                if ((v.type != BOOLEAN or tightBoolean(v)) and v.lower_bound <= v.upper_bound) {
                     f << "  " << v.lower_bound << " <= " << v.name << " <= " << v.upper_bound << endl;
                 }
             }
         }
 
-        if (numIntegerVars > 0) {
+        if (need_general) {
             f << "General" << endl << ' ';
             for (const Var& v: Vars) {
-                if (v.type == INTEGER) f << ' ' << v.name;
+                if (v.type == INTEGER or tightBoolean(v)) f << ' ' << v.name;
             }
             f << endl;
         }
 
-        if (numBooleanVars > 0) {
+        if (need_binary) {
             f << "Binary" << endl << ' ';
             for (const Var& v: Vars) {
-                if (v.type == BOOLEAN) f << ' ' << v.name;
+                if (v.type == BOOLEAN and not tightBoolean(v)) f << ' ' << v.name;
             }
             f << endl;
         }
@@ -746,6 +972,15 @@ private:
         f << "End" << endl;
     }
 
+    /**
+     * @brief Writes the current values of the variables as an initial solution (MST format).
+     * @param filename Name of the file.
+     */
+    void writeStart(const string& filename) {
+        ofstream f(filename);
+        for (const Var& v: Vars) f << v.name << ' ' << v.value << endl;
+    }
+
     /**
      * @brief Reads a line from an ifstream and puts all strings in a vector.
      * @param f The input stream.
@@ -924,10 +1159,11 @@ private:
      * @param lpfile name of the input file (CPLEX LP format).
      * @param solfile name of the solution file.
      * @param timeout Max amount of time to solve the problem (in seconds).
+     * @param startfile Name of the file with the initial solution (none if empty).
      * @return A string with the command to be executed.
      */
     string writeCommand(const string& solver, const string& lpfile, const string& solfile,
-                        int timeout = -1) {
+                        int timeout = -1, const string& startfile = "") {
         ostringstream command;
         command << solver << ' ';
         if (solver == "cbc") {
@@ -940,6 +1176,7 @@ private:
             command << " -w " << solfile;
         } else if (solver == "gurobi_cl") { //Carmine 25.02.22 gurobi_cl included as MILP solver
             if (timeout > 0) command << " TimeLimit=" << timeout;
+            if (not startfile.empty()) command << " InputFile=" << startfile;
             command << " ResultFile=" << solfile;
             command << " " << lpfile;
         } else {
@@ -0,0 +1,611 @@
+#ifndef NETLIST_BINARY_H
+#define NETLIST_BINARY_H
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * Binary interchange format of the dataflow netlists (.dfb), an alternative to
+ * the .dot files exchanged by the tools of the flow. A netlist is stored as an
+ * attributed graph: nodes, edges and the attributes of the graph, nodes and edges,
+ * exactly as they would be written in the .dot file. The file can be mapped in
+ * memory and read without parsing:
+ *
+ *   header  : magic, version, sizes and offsets of the sections  (Header)
+ *   strings : offset of each string, followed by the NUL-terminated strings
+ *   nodes   : string ID of the name of each node
+ *   edges   : source and destination node of each edge           (Edge)
+ *   columns : one per attribute, in order of declaration         (Column)
+ *
+ * Every attribute (column) has a key, a default value, the owner of its values
+ * (graph, nodes or edges) and a type: the values are integers or reals if all of
+ * them can be written back with the same text, and strings otherwise. The values
+ * of a column are stored contiguously, with a bitmap telling which elements have
+ * the attribute (the others take the default value). Sections are aligned to 8
+ * bytes and all the values are in the byte order of the host.
+ *
+ * The version is incremented whenever the layout changes; readers reject the
+ * files with a different version.
+ */
+
+namespace NetlistBinary
+{
+
+const uint32_t MAGIC = 0x424e4644u;     /// "DFNB"
+const uint32_t VERSION = 1u;
+const char* const EXTENSION = ".dfb";
+
+enum Owner : uint32_t {GRAPH, NODE, EDGE};          /// Elements with attributes
+enum ColumnType : uint32_t {INT, REAL, STRING};     /// Types of values
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t file_size;
+    uint32_t num_strings;
+    uint32_t num_nodes;
+    uint32_t num_edges;
+    uint32_t num_columns;
+    uint32_t graph_name;        /// String ID
+    uint32_t reserved;
+    uint64_t strings_offset;    /// uint32_t offsets[num_strings+1] relative to the chars, then the chars
+    uint64_t nodes_offset;      /// uint32_t name[num_nodes]
+    uint64_t edges_offset;      /// Edge[num_edges]
+    uint64_t columns_offset;    /// Column[num_columns]
+};
+
+struct Edge {
+    uint32_t src;
+    uint32_t dst;
+};
+
+struct Column {
+    uint32_t key;               /// String ID
+    uint32_t default_value;     /// String ID
+    uint32_t owner;             /// Owner
+    uint32_t type;              /// ColumnType
+    uint64_t presence_offset;   /// uint64_t bits[(count+63)/64]
+    uint64_t values_offset;     /// int64_t, double or uint32_t (string ID) [count]
+};
+
+/**
+ * @brief Indicates whether a file is in the binary format (by its magic number).
+ * @param filename Name of the file.
+ * @return True if the file starts with the magic number.
+ */
+inline bool isBinaryFile(const std::string& filename)
+{
+    std::ifstream f(filename, std::ios::binary);
+    uint32_t magic = 0;
+    return f.read(reinterpret_cast<char*>(&magic), sizeof(magic)) and magic == MAGIC;
+}
+
+/**
+ * @class Writer
+ * @brief Builds an attributed graph in memory and writes it in the binary format.
+ * Nodes and edges are identified by their index, in order of creation.
+ */
+class Writer
+{
+public:
+
+    Writer() {
+        stringID("");
+    }
+
+    void setGraphName(const std::string& name) {
+        graph_name = stringID(name);
+    }
+
+    /**
+     * @brief Adds a node.
+     * @return The index of the node.
+     */
+    int addNode(const std::string& name) {
+        node_names.push_back(stringID(name));
+        return node_names.size() - 1;
+    }
+
+    /**
+     * @brief Adds an edge between two nodes.
+     * @return The index of the edge.
+     */
+    int addEdge(int src, int dst) {
+        edges.push_back(Edge{uint32_t(src), uint32_t(dst)});
+        return edges.size() - 1;
+    }
+
+    /**
+     * @brief Declares an attribute. Attributes are declared implicitly (with an
+     * empty default value) when they are first set.
+     */
+    void declareAttr(Owner owner, const std::string& key, const std::string& default_value) {
+        getColumn(owner, key).default_value = default_value;
+    }
+
+    /**
+     * @brief Sets the value of an attribute.
+     * @param owner Owner of the attribute.
+     * @param index Index of the node or edge (ignored for the graph).
+     * @param key Name of the attribute.
+     * @param value Value of the attribute, as it would be written in the .dot file.
+     */
+    void setAttr(Owner owner, int index, const std::string& key, const std::string& value) {
+        getColumn(owner, key).values[owner == GRAPH ? 0 : index] = value;
+    }
+
+    /**
+     * @brief Writes the graph in a file.
+     * @param filename Name of the file.
+     * @param error Error message in case of failure.
+     * @return True if successful, and false otherwise.
+     */
+    bool write(const std::string& filename, std::string& error) {
+        std::vector<char> body;
+        Header h;
+        memset(&h, 0, sizeof(h));
+        append(body, &h, sizeof(h));
+
+        // The values of the columns, with their types (they may add strings)
+        std::vector<Column> cols;
+        std::vector<std::vector<char>> col_data;
+        for (const ColumnData& cd: columns) {
+            size_t count = elements(cd.owner);
+            std::vector<uint64_t> bits((count + 63) / 64, 0);
+            for (const auto& v: cd.values) {
+                if (v.first < count) bits[v.first / 64] |= uint64_t(1) << (v.first % 64);
+            }
+
+            Column col;
+            memset(&col, 0, sizeof(col));
+            col.key = stringID(cd.key);
+            col.default_value = stringID(cd.default_value);
+            col.owner = cd.owner;
+            col.type = inferType(cd);
+
+            std::vector<char> data;
+            append(data, bits.data(), bits.size() * sizeof(uint64_t));
+            for (size_t i = 0; i < count; i++) {
+                auto it = cd.values.find(i);
+                const std::string* value = it == cd.values.end() ? nullptr : &it->second;
+                if (col.type == INT) {
+                    int64_t x = value ? strtoll(value->c_str(), nullptr, 10) : 0;
+                    append(data, &x, sizeof(x));
+                } else if (col.type == REAL) {
+                    double x = value ? strtod(value->c_str(), nullptr) : 0.0;
+                    append(data, &x, sizeof(x));
+                } else {
+                    uint32_t x = value ? stringID(*value) : 0;
+                    append(data, &x, sizeof(x));
+                }
+            }
+            cols.push_back(col);
+            col_data.push_back(data);
+        }
+
+        // String table
+        align(body);
+        h.strings_offset = body.size();
+        h.num_strings = strings.size();
+        uint32_t pos = 0;
+        for (const std::string& s: strings) {
+            append(body, &pos, sizeof(pos));
+            pos += s.size() + 1;
+        }
+        append(body, &pos, sizeof(pos));
+        for (const std::string& s: strings) append(body, s.c_str(), s.size() + 1);
+
+        // Nodes and edges
+        align(body);
+        h.nodes_offset = body.size();
+        h.num_nodes = node_names.size();
+        append(body, node_names.data(), node_names.size() * sizeof(uint32_t));
+
+        align(body);
+        h.edges_offset = body.size();
+        h.num_edges = edges.size();
+        append(body, edges.data(), edges.size() * sizeof(Edge));
+
+        // Columns: the descriptors, followed by the presence bitmaps and values
+        align(body);
+        h.columns_offset = body.size();
+        h.num_columns = cols.size();
+        size_t data_offset = body.size() + cols.size() * sizeof(Column);
+        for (size_t i = 0; i < cols.size(); i++) {
+            data_offset = (data_offset + 7) & ~size_t(7);
+            size_t count = elements(Owner(cols[i].owner));
+            cols[i].presence_offset = data_offset;
+            cols[i].values_offset = data_offset + (count + 63) / 64 * sizeof(uint64_t);
+            data_offset += col_data[i].size();
+        }
+        append(body, cols.data(), cols.size() * sizeof(Column));
+        for (const auto& data: col_data) {
+            align(body);
+            append(body, data.data(), data.size());
+        }
+
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.graph_name = graph_name;
+        h.file_size = body.size();
+        memcpy(body.data(), &h, sizeof(h));
+
+        std::ofstream f(filename, std::ios::binary | std::ios::trunc);
+        if (not f.good()) {
+            error = "Could not open file " + filename;
+            return false;
+        }
+        f.write(body.data(), body.size());
+        if (not f.good()) {
+            error = "Could not write file " + filename;
+            return false;
+        }
+        return true;
+    }
+
+private:
+
+    struct ColumnData {
+        Owner owner;
+        std::string key;
+        std::string default_value;
+        std::map<size_t, std::string> values;
+    };
+
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> string_ids;
+    uint32_t graph_name = 0;
+    std::vector<uint32_t> node_names;
+    std::vector<Edge> edges;
+    std::vector<ColumnData> columns;    // In order of declaration
+    std::map<std::pair<Owner, std::string>, int> column_ids;
+
+    uint32_t stringID(const std::string& s) {
+        auto it = string_ids.find(s);
+        if (it != string_ids.end()) return it->second;
+        strings.push_back(s);
+        return string_ids[s] = strings.size() - 1;
+    }
+
+    ColumnData& getColumn(Owner owner, const std::string& key) {
+        auto it = column_ids.find(std::make_pair(owner, key));
+        if (it != column_ids.end()) return columns[it->second];
+        column_ids[std::make_pair(owner, key)] = columns.size();
+        columns.push_back(ColumnData());
+        columns.back().owner = owner;
+        columns.back().key = key;
+        return columns.back();
+    }
+
+    size_t elements(Owner owner) const {
+        return owner == GRAPH ? 1 : owner == NODE ? node_names.size() : edges.size();
+    }
+
+    // Integers are only stored as such if the text is the canonical one
+    static bool isInt(const std::string& s) {
+        if (s.empty() or s.size() > 18) return false;
+        size_t i = s[0] == '-' ? 1 : 0;
+        if (i == s.size() or (s[i] == '0' and s.size() > i + 1) or (i == 1 and s == "-0")) return false;
+        for (; i < s.size(); i++) {
+            if (s[i] < '0' or s[i] > '9') return false;
+        }
+        return true;
+    }
+
+    // Reals are only stored as such if they are written back with the same text
+    static bool isReal(const std::string& s) {
+        if (s.empty()) return false;
+        char* end;
+        errno = 0;
+        double x = strtod(s.c_str(), &end);
+        return *end == '\0' and errno == 0 and std::isfinite(x) and formatReal(x) == s;
+    }
+
+    ColumnType inferType(const ColumnData& cd) const {
+        bool all_int = true, all_real = true;
+        for (const auto& v: cd.values) {
+            all_int = all_int and isInt(v.second);
+            all_real = all_real and isReal(v.second);
+        }
+        return all_int ? INT : all_real ? REAL : STRING;
+    }
+
+    static void append(std::vector<char>& v, const void* data, size_t size) {
+        const char* p = static_cast<const char*>(data);
+        v.insert(v.end(), p, p + size);
+    }
+
+    static void align(std::vector<char>& v) {
+        v.resize((v.size() + 7) & ~size_t(7), 0);
+    }
+
+public:
+
+    /**
+     * @brief Shortest text of a real that is read back as the same value.
+     */
+    static std::string formatReal(double x) {
+        char buf[32];
+        for (int prec = 1; prec <= 17; prec++) {
+            snprintf(buf, sizeof(buf), "%.*g", prec, x);
+            if (strtod(buf, nullptr) == x) break;
+        }
+        return buf;
+    }
+};
+
+/**
+ * @class Reader
+ * @brief Read-only view of a binary file, mapped in memory.
+ */
+class Reader
+{
+public:
+
+    Reader() {}
+
+    ~Reader() {
+        close();
+    }
+
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    /**
+     * @brief Maps a file in memory and checks its consistency.
+     * @param filename Name of the file.
+     * @return True if successful, and false otherwise (see getError).
+     */
+    bool open(const std::string& filename) {
+        close();
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return setError("Could not open file " + filename);
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 or size_t(st.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return setError("File " + filename + " is not a binary netlist");
+        }
+        size = st.st_size;
+        void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return setError("Could not map file " + filename);
+        base = static_cast<const char*>(p);
+
+        if (not validate()) {
+            std::string msg = errorMsg;
+            close();
+            return setError(filename + ": " + msg);
+        }
+        return true;
+    }
+
+    void close() {
+        if (base != nullptr) munmap(const_cast<char*>(base), size);
+        base = nullptr;
+        size = 0;
+        hdr = nullptr;
+    }
+
+    const std::string& getError() const {
+        return errorMsg;
+    }
+
+    const char* graphName() const {
+        return getString(hdr->graph_name);
+    }
+
+    int numNodes() const {
+        return hdr->num_nodes;
+    }
+
+    int numEdges() const {
+        return hdr->num_edges;
+    }
+
+    int numColumns() const {
+        return hdr->num_columns;
+    }
+
+    const char* nodeName(int node) const {
+        return getString(at<uint32_t>(hdr->nodes_offset)[node]);
+    }
+
+    int edgeSrc(int edge) const {
+        return at<Edge>(hdr->edges_offset)[edge].src;
+    }
+
+    int edgeDst(int edge) const {
+        return at<Edge>(hdr->edges_offset)[edge].dst;
+    }
+
+    const Column& column(int col) const {
+        return at<Column>(hdr->columns_offset)[col];
+    }
+
+    const char* columnKey(int col) const {
+        return getString(column(col).key);
+    }
+
+    const char* columnDefault(int col) const {
+        return getString(column(col).default_value);
+    }
+
+    /**
+     * @brief Finds the column of an attribute.
+     * @return The index of the column, or -1 if the attribute does not exist.
+     */
+    int findColumn(Owner owner, const std::string& key) const {
+        for (int col = 0; col < numColumns(); col++) {
+            if (column(col).owner == owner and key == columnKey(col)) return col;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Indicates whether an element has a value of the attribute.
+     */
+    bool has(int col, int index) const {
+        const uint64_t* bits = at<uint64_t>(column(col).presence_offset);
+        return (bits[index / 64] >> (index % 64)) & 1;
+    }
+
+    int64_t getInt(int col, int index) const {
+        const Column& c = column(col);
+        if (c.type == INT) return at<int64_t>(c.values_offset)[index];
+        if (c.type == REAL) return at<double>(c.values_offset)[index];
+        return strtoll(getString(at<uint32_t>(c.values_offset)[index]), nullptr, 10);
+    }
+
+    double getReal(int col, int index) const {
+        const Column& c = column(col);
+        if (c.type == INT) return at<int64_t>(c.values_offset)[index];
+        if (c.type == REAL) return at<double>(c.values_offset)[index];
+        return strtod(getString(at<uint32_t>(c.values_offset)[index]), nullptr);
+    }
+
+    /**
+     * @brief Text of the value of an attribute, as in the .dot file.
+     * The default value is returned for the elements without the attribute.
+     */
+    std::string getText(int col, int index) const {
+        if (not has(col, index)) return columnDefault(col);
+        const Column& c = column(col);
+        if (c.type == INT) return std::to_string(at<int64_t>(c.values_offset)[index]);
+        if (c.type == REAL) return Writer::formatReal(at<double>(c.values_offset)[index]);
+        return getString(at<uint32_t>(c.values_offset)[index]);
+    }
+
+    const char* getString(uint32_t id) const {
+        return at<char>(strings_chars) + at<uint32_t>(hdr->strings_offset)[id];
+    }
+
+    /**
+     * @brief Writes the graph in dot format (for debugging).
+     */
+    void writeDot(std::ostream& s) const {
+        s << "Digraph " << quote(graphName()) << " {" << std::endl;
+        for (int col = 0; col < numColumns(); col++) {
+            if (column(col).owner == GRAPH and has(col, 0)) {
+                s << "\t" << quote(columnKey(col)) << "=" << quote(getText(col, 0)) << ";" << std::endl;
+            }
+        }
+        for (int n = 0; n < numNodes(); n++) {
+            s << "\t" << quote(nodeName(n));
+            writeAttrs(s, NODE, n);
+            s << ";" << std::endl;
+        }
+        for (int e = 0; e < numEdges(); e++) {
+            s << "\t" << quote(nodeName(edgeSrc(e))) << " -> " << quote(nodeName(edgeDst(e)));
+            writeAttrs(s, EDGE, e);
+            s << ";" << std::endl;
+        }
+        s << "}" << std::endl;
+    }
+
+private:
+
+    const char* base = nullptr;
+    size_t size = 0;
+    const Header* hdr = nullptr;
+    uint64_t strings_chars = 0;
+    std::string errorMsg;
+
+    template<typename T>
+    const T* at(uint64_t offset) const {
+        return reinterpret_cast<const T*>(base + offset);
+    }
+
+    bool setError(const std::string& err) {
+        errorMsg = err;
+        return false;
+    }
+
+    bool inside(uint64_t offset, uint64_t bytes) const {
+        return offset % 8 == 0 and offset <= size and bytes <= size - offset;
+    }
+
+    // Checks that all the sections, strings and references are inside the file
+    bool validate() {
+        hdr = at<Header>(0);
+        if (hdr->magic != MAGIC) return setError("not a binary netlist");
+        if (hdr->version != VERSION) {
+            return setError("unsupported version " + std::to_string(hdr->version) +
+                            " (expected " + std::to_string(VERSION) + ")");
+        }
+        if (hdr->file_size != size) return setError("truncated file");
+
+        uint64_t nstr = hdr->num_strings;
+        if (nstr == 0 or not inside(hdr->strings_offset, (nstr + 1) * sizeof(uint32_t))) return setError("bad string table");
+        strings_chars = hdr->strings_offset + (nstr + 1) * sizeof(uint32_t);
+        const uint32_t* offsets = at<uint32_t>(hdr->strings_offset);
+        if (offsets[nstr] > size - strings_chars) return setError("bad string table");
+        for (uint64_t i = 0; i < nstr; i++) {
+            if (offsets[i] >= offsets[i+1] or base[strings_chars + offsets[i+1] - 1] != '\0') return setError("bad string table");
+        }
+
+        if (not inside(hdr->nodes_offset, uint64_t(hdr->num_nodes) * sizeof(uint32_t)) or
+            not inside(hdr->edges_offset, uint64_t(hdr->num_edges) * sizeof(Edge)) or
+            not inside(hdr->columns_offset, uint64_t(hdr->num_columns) * sizeof(Column))) return setError("bad sections");
+
+        if (hdr->graph_name >= nstr) return setError("bad string reference");
+        for (int n = 0; n < numNodes(); n++) {
+            if (at<uint32_t>(hdr->nodes_offset)[n] >= nstr) return setError("bad string reference");
+        }
+        for (int e = 0; e < numEdges(); e++) {
+            if (edgeSrc(e) >= numNodes() or edgeDst(e) >= numNodes()) return setError("bad edge");
+        }
+
+        for (int col = 0; col < numColumns(); col++) {
+            const Column& c = column(col);
+            if (c.key >= nstr or c.default_value >= nstr or c.owner > EDGE or c.type > STRING) return setError("bad column");
+            uint64_t count = c.owner == GRAPH ? 1 : c.owner == NODE ? hdr->num_nodes : hdr->num_edges;
+            uint64_t elem = c.type == STRING ? sizeof(uint32_t) : sizeof(uint64_t);
+            if (not inside(c.presence_offset, (count + 63) / 64 * sizeof(uint64_t)) or
+                not inside(c.values_offset, count * elem)) return setError("bad column");
+            if (c.type == STRING) {
+                for (uint64_t i = 0; i < count; i++) {
+                    if (at<uint32_t>(c.values_offset)[i] >= nstr) return setError("bad string reference");
+                }
+            }
+        }
+        return true;
+    }
+
+    static std::string quote(const std::string& s) {
+        std::string q = "\"";
+        for (char ch: s) {
+            if (ch == '"') q += '\\';
+            q += ch;
+        }
+        return q + "\"";
+    }
+
+    void writeAttrs(std::ostream& s, Owner owner, int index) const {
+        bool first = true;
+        for (int col = 0; col < numColumns(); col++) {
+            if (column(col).owner != owner or not has(col, index)) continue;
+            s << (first ? " [" : ", ") << columnKey(col) << "=" << quote(getText(col, index));
+            first = false;
+        }
+        if (not first) s << "]";
+    }
+};
+
+}
+
+#endif // NETLIST_BINARY_H
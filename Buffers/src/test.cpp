@@ -61,6 +61,9 @@ int main_help()
     cerr << "Available commands:" << endl;
     cerr << "  dataflow:      handling dataflow netlists." << endl;
     cerr << "  buffers:       add elastic buffers to a netlist." << endl;
+    cerr << "  dot2dfb:       convert a dot netlist into binary format." << endl;
+    cerr << "  dfb2dot:       convert a binary netlist into dot format." << endl;
+    cerr << "  simulate:      simulate a netlist at token level." << endl;
     cerr << "  async_synth:   synthesize an asynchronous circuit." << endl;
     cerr << "  solveCSC:      solve state encoding in an asynchronous circuit." << endl;
     cerr << "  hideSignals:   hide signals in an asynchronous specification." << endl;
@@ -83,6 +86,10 @@ struct user_input {
     string add_buff_txt; //Carmine 09.02.2022 option of additional buffer - text contains where to add buffers
     string model_mode; //Carmine 16.02.2022 option to set the model mode - default/ready/valid/all/mixed
     string lib; //Carmine 17.02.2022 it is the path containing the libraries of delays 
+    int threads; // number of MILPs of disjoint MGs solved concurrently
+    int simulate; // iterations of the token-level simulation of the MGs (0: no simulation)
+    string cache; // directory of the buffer cache (empty: no cache)
+    bool binary; // whether the optimized netlist is also written in binary format
 };
 
 void clear_input(user_input& input) {
@@ -96,6 +103,10 @@ void clear_input(user_input& input) {
     input.add_buff_txt = ""; //Carmine 09.02.2022 option of additional buffer - null if it is not present
     input.model_mode = "default"; //Carmine 16.02.2022 the default option means not modifying FPGA'20 MILP model
     input.lib = "/home/dynamatic/Downloads/Carmine/results_buff_opt"; 
+    input.threads = 1;
+    input.simulate = 0;
+    input.cache = "";
+    input.binary = false;
     //Carmine 17.02.2022 it is the path containing the libraries of delays 
 }
 
@@ -105,6 +116,10 @@ void print_input(const user_input& input) {
     cout << "milp solver: " << input.solver << endl;
     cout << "delay: " << input.delay << ", period: " << input.period << endl;
     cout << "timeout: " << input.timeout << endl;
+    cout << "milp threads: " << input.threads << endl;
+    cout << "simulation iterations: " << input.simulate << endl;
+    cout << "buffer cache: " << (input.cache == "" ? "disabled" : input.cache) << endl;
+    cout << "binary output: " << (input.binary ? "true" : "false") << endl;
     cout << "set optimization: " << (input.set ? "true" : "false") << endl;
     cout << "first MG optimization: " << (input.first ? "true" : "false") << endl;
     cout << "milp model mode: " << input.model_mode << endl;
@@ -124,6 +139,10 @@ void parse_user_input(const vecParams& params, user_input& input) {
     regex add_buff_regex("(-add_buff=)(.*)"); //Carmine 09.02.2022 option of additional buffer
     regex model_mode_regex("(-model_mode=)(.*)"); //Carmine 16.02.2022 option of model mode
     regex lib_regex("(-lib=)(.*)"); //Carmine 17.02.2022 option of library of delays
+    regex threads_regex("(-threads=)(.*)");
+    regex simulate_regex("(-simulate=)(.*)");
+    regex cache_regex("(-cache=)(.*)");
+    regex binary_regex("(-binary=)(.*)");
     for (auto param: params) {
         if (regex_match(param, period_regex)) {
             input.period = atof(param.substr(param.find("=") + 1).c_str());
@@ -154,6 +173,15 @@ void parse_user_input(const vecParams& params, user_input& input) {
         } else if (regex_match(param, lib_regex)) {
             string tmp = param.substr(param.find("=") + 1);
             input.lib = tmp;
+        } else if (regex_match(param, threads_regex)) {
+            input.threads = atoi(param.substr(param.find("=") + 1).c_str());
+        } else if (regex_match(param, simulate_regex)) {
+            input.simulate = atoi(param.substr(param.find("=") + 1).c_str());
+        } else if (regex_match(param, cache_regex)) {
+            input.cache = param.substr(param.find("=") + 1);
+        } else if (regex_match(param, binary_regex)) {
+            string tmp = param.substr(param.find("=") + 1);
+            input.binary = (tmp == "true") ? true : false;
         } else {
             cout << param << " is invalid argument" << endl;
             assert(false);
@@ -169,10 +197,18 @@ void show_help_shab() {
     cout << "\tdefault value is 3" << endl;
     cout << "-delay: the units' delay" << endl;
     cout << "\tdefault value is 0.0" << endl;
-    cout << "-solver: the milp solver" << endl;
+    cout << "-solver: the milp solver (cbc_lib, cbc, glpsol or gurobi_cl)" << endl;
     cout << "\tdefault value is cbc" << endl;
     cout << "-timeout: the milp timeout. If -1, no limit will be applied" << endl;
     cout << "\tdefault value is -1" << endl;
+    cout << "-threads: number of MILPs of disjoint MGs built and solved concurrently (only with -set)" << endl;
+    cout << "\tdefault value is 1" << endl;
+    cout << "-simulate: number of iterations of the token-level simulation of the MGs after adding buffers (0: no simulation)" << endl;
+    cout << "\tdefault value is 0" << endl;
+    cout << "-cache: directory where the buffers of every disjoint MG are stored and reused by later runs (only with -set)" << endl;
+    cout << "\tdefault value is \"\" (no cache)" << endl;
+    cout << "-binary: whether the optimized netlist is also written to <filename>_graph_buf.dfb (binary format)" << endl;
+    cout << "\tdefault value is false" << endl;
     cout << "-set: whether set optimization should be applied or not" << endl;
     cout << "\tdefault value is false" << endl;
     cout << "-first: whether the milp should only consider the throughput for the first MG or not" << endl;
@@ -199,6 +235,8 @@ int main_shab(const vecParams& params){
     cout << "Adding elastic buffers with period=" << input.period << " and buffer_delay=" << input.delay << endl;
     cout << endl;
     DF.setMilpSolver(input.solver);
+    DF.setMilpThreads(input.threads);
+    DF.setBufferCache(input.cache);
 
     bool stat;
     if (input.set) {
@@ -207,6 +245,9 @@ int main_shab(const vecParams& params){
         stat = DF.addElasticBuffersBB(input.period, input.delay, true, 1, input.timeout, input.first);
     }
     if (stat) {
+        if (input.simulate > 0 and not DF.simulateMarkedGraphs(input.simulate)) {
+            cout << DF.getError() << endl;
+        }
         DF.instantiateElasticBuffers();
     }else{
         cout << DF.getError() << endl;      //Carmine 03.03.22 important to find out what the problem is 
@@ -222,6 +263,49 @@ int main_shab(const vecParams& params){
 
     DF.writeDot(input.graph_name + "_graph_buf.dot");
     DF.writeDotBB(input.graph_name + "_bbgraph_buf.dot");
+    if (input.binary and not DF.writeBinary(input.graph_name + "_graph_buf.dfb")) {
+        cerr << DF.getError() << endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Conversion between dot and binary netlists (dot2dfb and dfb2dot)
+int main_convert(const vecParams& params)
+{
+    if (params.size() != 2) {
+        cerr << "Usage: " + exec + ' ' + command + " infile outfile" << endl;
+        return 1;
+    }
+
+    string error;
+    bool to_binary = command == "dot2dfb";
+    if (not (to_binary ? convertDotToBinary(params[0], params[1], error) : convertBinaryToDot(params[0], params[1], error))) {
+        cerr << error << endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Token-level simulation of a netlist (with the frequencies of its BB graph, if given)
+int main_simulate(const vecParams& params)
+{
+    if (params.size() < 1 or params.size() > 3) {
+        cerr << "Usage: " + exec + ' ' + command + " infile [bbfile [max_cycles]]" << endl;
+        return 1;
+    }
+
+    DFnetlist DF = params.size() == 1 ? DFnetlist(params[0]) : DFnetlist(params[0], params[1]);
+    if (DF.hasError()) {
+        cerr << DF.getError() << endl;
+        return 1;
+    }
+
+    long long maxCycles = params.size() == 3 ? atoll(params[2].c_str()) : 100000000;
+    if (not DF.simulateNetlist(maxCycles)) {
+        cerr << DF.getError() << endl;
+        return 1;
+    }
     return 0;
 }
 
@@ -250,6 +334,8 @@ int main(int argc, char *argv[])
     if (command == "buffers_old") return main_buffers(params);
     if (command == "buffers") return main_shab(params);
     if (command == "test") return main_test(params);
+    if (command == "dot2dfb" or command == "dfb2dot") return main_convert(params);
+    if (command == "simulate") return main_simulate(params);
 
 #if 0
     if (command == "dataflow") return main_dataflow(params);
@@ -49,6 +49,7 @@ string current_file;
 string project_dir;
 
 #define OUTPUT_DIR "/reports/"
+#define BUFFER_CACHE_DIR "/.buffers_cache"
 
 enum
 {
@@ -658,6 +659,9 @@ int optimize ( string input_cmp )
 	{
         	command += " -model_mode=";     //Carmine 23.02.22 adding the functionality of milp mode to dynamatic basic code
         	command += milp_mode;
+        	command += " -cache=";          // buffers of unchanged MGs are reused from previous runs
+        	command += project_dir;
+        	command += BUFFER_CACHE_DIR;
 	}
         command += " -solver=";     //Carmine 25.02.22 set milp solver
         command += milp_solver;
@@ -21,6 +21,9 @@
 #include <list>
 #include <cctype>
 #include <sstream> 
+#include <atomic>
+#include <thread>
+#include <cstdlib>
 
 #include "dot2hdl.h"
 #include "dot_parser.h"
@@ -38,6 +41,12 @@ ofstream lsq_configuration_file;
 
 #define MAX_LSQ 256
 
+// Each generator is a JVM with a large heap (lsq_generate runs java -Xmx7G),
+// so only a few of them run at the same time. The limit can be changed with
+// the DOT2HDL_LSQ_JOBS environment variable.
+#define LSQ_JOBS_DEFAULT 2
+#define LSQ_JOBS_ENV "DOT2HDL_LSQ_JOBS"
+
 LSQ_CONFIGURATION_T lsq_conf[MAX_LSQ];
 
 
@@ -893,7 +902,7 @@ void lsq_write_configuration_file ( string top_level_filename, int lsq_indx )
 void lsq_generate_configuration ( string top_level_filename )
 {
     
-    for ( int lsq_indx; lsq_indx < lsqs_in_netlist; lsq_indx++ )
+    for ( int lsq_indx = 0; lsq_indx < lsqs_in_netlist; lsq_indx++ )
     {    
         lsq_set_configuration ( lsq_indx );
         lsq_write_configuration_file( top_level_filename, lsq_indx );
@@ -901,49 +910,75 @@ void lsq_generate_configuration ( string top_level_filename )
 }
 
 
-void lsq_generate ( string top_level_filename )
+// Runs the generator of one LSQ and returns its output
+string lsq_run_generator ( string top_level_filename, int lsq_indx )
 {
-    
     FILE *fp;
     char path[1035];
-    stringstream ss_path, string_path;
+    string output;
     
     char cmd[512];
-       
-    //int lsq_indx;
 
-    for ( int lsq_indx; lsq_indx < lsqs_in_netlist; lsq_indx++ )
-    {    
+    //sprintf ( cmd, "java -jar -Xmx7G lsq.jar --target-dir %s --spec-file %s.json", top_level_filename.c_str(), top_level_filename.c_str() );
+    //sprintf ( cmd, "java -jar -Xmx7G lsq.jar --target-dir . --spec-file %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
+    //sprintf ( cmd, "java -jar -Xmx7G /home/dynamatic/Dynamatic/bin/lsq.jar --target-dir . --spec-file %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
+    
+    sprintf ( cmd, "lsq_generate %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
 
-        cout << "Generating LSQ " << lsq_indx << " component..." << endl;
+    output = "Generating LSQ " + to_string(lsq_indx) + " component...\n";
+    output += cmd;
+    output += "\n";
 
-        //sprintf ( cmd, "java -jar -Xmx7G lsq.jar --target-dir %s --spec-file %s.json", top_level_filename.c_str(), top_level_filename.c_str() );
-        //sprintf ( cmd, "java -jar -Xmx7G lsq.jar --target-dir . --spec-file %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
-        //sprintf ( cmd, "java -jar -Xmx7G /home/dynamatic/Dynamatic/bin/lsq.jar --target-dir . --spec-file %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
-        
-        sprintf ( cmd, "lsq_generate %s_lsq%d_configuration.json",  top_level_filename.c_str(), lsq_indx );
-        
-    
-        cout << cmd << endl;
+    /* Open the command for reading. */
+    fp = popen( cmd, "r" );
+    if (fp == NULL) 
+    {
+        return output;
+    }
 
-        /* Open the command for reading. */
-        fp = popen( cmd, "r" );
-        if (fp == NULL) 
-        {
-            return;
-        }
+    /* Read the output a line at a time - keep it. */
+    while (fgets(path, sizeof(path)-1, fp) != NULL) 
+    {
+        output += path;
+    }
+
+    /* close */
+    pclose(fp);    
+
+    return output;
+}
+
+// The LSQs are generated independently (each one from its own configuration file),
+// so up to LSQ_JOBS_DEFAULT (or DOT2HDL_LSQ_JOBS) generators run concurrently.
+// Their outputs are printed in the order of the LSQs.
+void lsq_generate ( string top_level_filename )
+{
+    vector<string> output(lsqs_in_netlist);
+    atomic<int> next_lsq(0);
 
-        /* Read the output a line at a time - output it. */
-        while (fgets(path, sizeof(path)-1, fp) != NULL) 
+    auto worker = [&] () {
+        for ( int lsq_indx = next_lsq++; lsq_indx < lsqs_in_netlist; lsq_indx = next_lsq++ )
         {
-            printf("%s", path);
+            output[lsq_indx] = lsq_run_generator ( top_level_filename, lsq_indx );
         }
+    };
 
-        /* close */
-        pclose(fp);    
-        
-        //cout << "Generating LSQ component..." << endl;
+    int max_jobs = LSQ_JOBS_DEFAULT;
+    const char* jobs = getenv ( LSQ_JOBS_ENV );
+    if ( jobs != NULL && atoi ( jobs ) > 0 ) max_jobs = atoi ( jobs );
+
+    int num_threads = min ( max_jobs, lsqs_in_netlist );
+    if ( num_threads <= 1 ) worker();
+    else
+    {
+        vector<thread> pool;
+        for ( int t = 0; t < num_threads; t++ ) pool.emplace_back ( worker );
+        for ( thread& t: pool ) t.join();
+    }
 
+    for ( int lsq_indx = 0; lsq_indx < lsqs_in_netlist; lsq_indx++ )
+    {
+        cout << output[lsq_indx];
     }
 }
 
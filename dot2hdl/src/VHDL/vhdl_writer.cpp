@@ -19,6 +19,8 @@
 #include <list>
 #include <cctype>
 #include <math.h>
+#include <sstream>
+#include <thread>
 
 #include "dot2hdl.h"
 #include "dot_parser.h"
@@ -144,22 +146,68 @@ ofstream netlist;
 ofstream tb_wrapper;
 
 
-void write_signals (  )
+// Below this number of nodes per thread, a pass is written by a single thread
+#define MIN_NODES_PER_THREAD 64
+
+// Writes the nodes [first, last) of a pass in out, and the messages for the user in messages
+typedef void (*WRITE_NODES_T) ( ostream& out, ostream& messages, int indx, int first, int last );
+
+// The text of every node only depends on the netlist, so the nodes of a pass are
+// split in ranges written in parallel, each one in its own buffers. The buffers
+// are then appended to the netlist in order, so the file does not depend on the
+// number of threads.
+void write_nodes ( WRITE_NODES_T write_range, int indx )
+{
+    int num_threads = min ( (int) thread::hardware_concurrency(), components_in_netlist / MIN_NODES_PER_THREAD );
+
+    if ( num_threads <= 1 )
+    {
+        write_range ( netlist, cout, indx, 0, components_in_netlist );
+        return;
+    }
+
+    // Ports are only accessed up to the parsed size, or at 0 for nodes without
+    // ports, so the vectors are sized here and no thread resizes them.
+    for ( int i = 0; i < components_in_netlist; i++ )
+    {
+        nodes[i].inputs.input.fit ( max ( nodes[i].inputs.size, 1 ) );
+        nodes[i].outputs.output.fit ( max ( nodes[i].outputs.size, 1 ) );
+    }
+
+    vector<ostringstream> out(num_threads), messages(num_threads);
+    vector<thread> pool;
+    for ( int t = 0; t < num_threads; t++ )
+    {
+        int first = (long) components_in_netlist * t / num_threads;
+        int last = (long) components_in_netlist * (t + 1) / num_threads;
+        pool.emplace_back ( [&, t, first, last] () { write_range ( out[t], messages[t], indx, first, last ); } );
+    }
+    for ( thread& t: pool ) t.join();
+
+    for ( int t = 0; t < num_threads; t++ )
+    {
+        cout << messages[t].str();
+        netlist << out[t].str();
+    }
+}
+
+
+void write_signals_nodes ( ostream& out, ostream& messages, int indx_unused, int first, int last )
 {
     int indx;
     string signal;
 
-    for ( int i = 0; i < components_in_netlist; i++ ) 
+    for ( int i = first; i < last; i++ ) 
     {
         if ( ( nodes[i].name.empty() ) ) //Check if the name is not empty
         {
-                cout << "**Warning: node " << i << " does not have an instance name -- skipping node **" << endl; 
+                messages << "**Warning: node " << i << " does not have an instance name -- skipping node **" << endl; 
         }
         else
         {
-                netlist << endl;
-                netlist << "\t" << SIGNAL_STRING<< nodes[i].name << "_clk : std_logic;"<< endl;
-                netlist << "\t" << SIGNAL_STRING<< nodes[i].name << "_rst : std_logic;" << endl;
+                out << endl;
+                out << "\t" << SIGNAL_STRING<< nodes[i].name << "_clk : std_logic;"<< endl;
+                out << "\t" << SIGNAL_STRING<< nodes[i].name << "_rst : std_logic;" << endl;
                 
                 for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
                 {
@@ -212,7 +260,7 @@ void write_signals (  )
                                 signal += " downto 0);";
                             }  
                             signal += '\n';
-                            netlist << "\t"  << signal ;
+                            out << "\t"  << signal ;
                         }
                     }
                 }   
@@ -229,7 +277,7 @@ void write_signals (  )
                     signal += COLOUMN;
                     signal += STD_LOGIC ;
                     signal += '\n';
-                    netlist << "\t"  << signal ;
+                    out << "\t"  << signal ;
                 }
                 for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
                 {
@@ -244,7 +292,7 @@ void write_signals (  )
                     signal += COLOUMN;
                     signal += STD_LOGIC ;
                     signal += '\n';
-                    netlist << "\t"  << signal ;
+                    out << "\t"  << signal ;
                     
               }
                 
@@ -260,7 +308,7 @@ void write_signals (  )
                     signal += COLOUMN;
                     signal += STD_LOGIC ;
                     signal += '\n';
-                    netlist << "\t"  << signal ;
+                    out << "\t"  << signal ;
                     
                     //Write the Valid Signals
                     signal = SIGNAL_STRING;
@@ -272,7 +320,7 @@ void write_signals (  )
                     signal += COLOUMN;
                     signal += STD_LOGIC ;
                     signal += '\n';
-                    netlist << "\t"  << signal ;
+                    out << "\t"  << signal ;
 
                     for ( int out_port_indx = 0; out_port_indx < components_type[nodes[i].component_type].out_ports; out_port_indx++) 
                     {
@@ -289,7 +337,7 @@ void write_signals (  )
                         signal += " downto 0);";
                         signal += '\n';
 
-                        netlist << "\t" << signal ;
+                        out << "\t" << signal ;
                         
                     }
                 }
@@ -309,7 +357,7 @@ void write_signals (  )
                 signal +=" std_logic;";
                 signal += '\n';
                 
-                netlist << "\t" << signal ;
+                out << "\t" << signal ;
 
                 signal = SIGNAL_STRING;
                 signal += nodes[i].name;
@@ -322,7 +370,7 @@ void write_signals (  )
                 signal +=" std_logic_vector (31 downto 0);";
                 signal += '\n';
                 
-                netlist << "\t" << signal ;
+                out << "\t" << signal ;
 
                 signal = SIGNAL_STRING;
                 signal += nodes[i].name;
@@ -335,7 +383,7 @@ void write_signals (  )
                 signal +=" std_logic;";
                 signal += '\n';
                 
-                netlist << "\t" << signal ;
+                out << "\t" << signal ;
 
             }
 
@@ -347,7 +395,7 @@ void write_signals (  )
             signal += "io_queueEmpty";
             signal += COLOUMN;
             signal += STD_LOGIC ;
-            netlist << "\t" << signal << endl;
+            out << "\t" << signal << endl;
         }
         
         if ( nodes[i].type == "MC" || nodes[i].type == "LSQ" )
@@ -358,7 +406,7 @@ void write_signals (  )
             signal += "we0_ce0";
             signal += COLOUMN;
             signal += STD_LOGIC ;
-            netlist << "\t" << signal << endl;
+            out << "\t" << signal << endl;
             
         }
         
@@ -366,20 +414,20 @@ void write_signals (  )
         if ( nodes[i].type.find("LSQ") != std::string::npos )
         {
 
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_address0 : std_logic_vector (" << (nodes[i].address_size -1 ) << " downto 0);" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_ce0 : std_logic;" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_we0 : std_logic;" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_dout0 : std_logic_vector (31 downto 0);" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_din0 : std_logic_vector (31 downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_address0 : std_logic_vector (" << (nodes[i].address_size -1 ) << " downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_ce0 : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_we0 : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_dout0 : std_logic_vector (31 downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_din0 : std_logic_vector (31 downto 0);" << endl;
             
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_address1 : std_logic_vector (" << (nodes[i].address_size - 1)  << " downto 0);" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_ce1 : std_logic;" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_we1 : std_logic;" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_dout1 : std_logic_vector (31 downto 0);" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_din1 : std_logic_vector (31 downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_address1 : std_logic_vector (" << (nodes[i].address_size - 1)  << " downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_ce1 : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_we1 : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_dout1 : std_logic_vector (31 downto 0);" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_din1 : std_logic_vector (31 downto 0);" << endl;
             
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_load_ready : std_logic;" << endl;
-            netlist << "\t" << SIGNAL_STRING << nodes[i].name << "_store_ready : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_load_ready : std_logic;" << endl;
+            out << "\t" << SIGNAL_STRING << nodes[i].name << "_store_ready : std_logic;" << endl;
 
             
         }
@@ -388,25 +436,26 @@ void write_signals (  )
 
 }
 
+void write_signals (  )
+{
+    write_nodes ( write_signals_nodes, 0 );
+}
+
 #include <bits/stdc++.h> 
 
                     
-void write_connections (  int indx )
+void write_connections_nodes ( ostream& out, ostream& messages, int indx, int first, int last )
 {
     string signal_1, signal_2;
 
-    netlist << endl;
-
-    //netlist << "\t" << "ap_ready <= '1';" << endl;
-    
     if ( indx == 0 ) // Top-level module
     {
-        for (int i = 0; i < components_in_netlist; i++ ) 
+        for (int i = first; i < last; i++ ) 
         {
-            netlist << endl;
+            out << endl;
             
-            netlist << "\t" << nodes[i].name << UNDERSCORE  << "clk" << " <= " << "clk" <<  SEMICOLOUMN << endl;
-            netlist << "\t" << nodes[i].name << UNDERSCORE  << "rst" << " <= " << "rst" <<  SEMICOLOUMN << endl;
+            out << "\t" << nodes[i].name << UNDERSCORE  << "clk" << " <= " << "clk" <<  SEMICOLOUMN << endl;
+            out << "\t" << nodes[i].name << UNDERSCORE  << "rst" << " <= " << "rst" <<  SEMICOLOUMN << endl;
             
             
             
@@ -420,7 +469,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 +="we0_ce0";
                     
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
 
                     signal_1 = nodes[i].memory;
                     signal_1 += UNDERSCORE;
@@ -431,7 +480,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 +="we0_ce0";
                     
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
             }
 
                     //LSQ-MC Modifications
@@ -461,7 +510,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += to_string( indx );
                     
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
                         
                         signal_1 = nodes[i].name;
                         signal_1 += UNDERSCORE;
@@ -472,7 +521,7 @@ void write_connections (  int indx )
                 
                         signal_2 = "'1'";
                         
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
                         
                         
  
@@ -492,7 +541,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 += "din1";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
 
                     signal_1 = nodes[i].name;
                     signal_1 += UNDERSCORE;
@@ -500,7 +549,7 @@ void write_connections (  int indx )
 
                     signal_2 = "'1'";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl; 
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl; 
 
                     signal_1 = nodes[i].name;
                     signal_1 += UNDERSCORE;
@@ -508,7 +557,7 @@ void write_connections (  int indx )
 
                     signal_2 = "'1'";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl; 
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl; 
                 }  
 
                 for ( int indx = 0; indx < nodes[i].outputs.size; indx++ )
@@ -532,7 +581,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += to_string( indx );
                     
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
                         
                         signal_1 = nodes[i].name;
                         signal_1 += UNDERSCORE;
@@ -545,7 +594,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += "address1";
 
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
                         
                         signal_1 = nodes[i].name;
                         signal_1 += UNDERSCORE;
@@ -558,7 +607,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += "ce1";
 
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
                         
  
                     }else
@@ -583,7 +632,7 @@ void write_connections (  int indx )
                             signal_2 += UNDERSCORE;
                             signal_2 += "we0_ce0";
 
-                            netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                            out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
 
                             signal_1 = nodes[i].name;
                             signal_1 += UNDERSCORE;
@@ -596,7 +645,7 @@ void write_connections (  int indx )
                             signal_2 += UNDERSCORE;
                             signal_2 += to_string( indx );
 
-                            netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                            out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
 
                             
                             signal_1 = nodes[i].name;
@@ -611,7 +660,7 @@ void write_connections (  int indx )
                             signal_2 += "address0";
 
 
-                            netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                            out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
 
                             
                         }
@@ -633,7 +682,7 @@ void write_connections (  int indx )
                             signal_2 += UNDERSCORE;
                             signal_2 += "we0_ce0";
 
-                            netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                            out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
 
                             signal_1 = nodes[i].name;
                             signal_1 += UNDERSCORE;
@@ -646,7 +695,7 @@ void write_connections (  int indx )
                             signal_2 += UNDERSCORE;
                             signal_2 += "dout0";
                             
-                            netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
+                            out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;     
 
                             
                         }
@@ -671,7 +720,7 @@ void write_connections (  int indx )
                     
                     //netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
                     
-                    netlist << "\t" << signal_1 << " <= std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
+                    out << "\t" << signal_1 << " <= std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
 
 
                     signal_1 = nodes[i].memory;
@@ -682,7 +731,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 += "ce1";
                     
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
 
                     signal_1 = nodes[i].memory;
                     signal_1 += UNDERSCORE;
@@ -693,7 +742,7 @@ void write_connections (  int indx )
                     signal_2 += "address0";
 
                     //netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
-                    netlist << "\t" << signal_1 << " <= std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
+                    out << "\t" << signal_1 << " <= std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
 
 
                     signal_1 = nodes[i].memory;
@@ -704,7 +753,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 += "we0_ce0";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
 
                     signal_1 = nodes[i].memory;
                     signal_1 += UNDERSCORE;
@@ -714,7 +763,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 += "we0_ce0";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
 
                     signal_1 = nodes[i].memory;
                     signal_1 += UNDERSCORE;
@@ -724,7 +773,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 += "dout0";
 
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;  
                 }      
         }
 
@@ -745,7 +794,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 +="din";
                     
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
                 }
                 
                 signal_1 = nodes[i].name;
@@ -763,7 +812,7 @@ void write_connections (  int indx )
 
                 signal_2 = "start_valid";
 
-                netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
+                out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
 
                 
                 if ( ( nodes[i].name.find("start") != std::string::npos ) )
@@ -783,7 +832,7 @@ void write_connections (  int indx )
 
                     signal_2 = "start_ready";
 
-                    netlist << "\t"  << signal_2  << " <= " << signal_1 << SEMICOLOUMN << endl;
+                    out << "\t"  << signal_2  << " <= " << signal_1 << SEMICOLOUMN << endl;
                 }
                 
                 
@@ -800,7 +849,7 @@ void write_connections (  int indx )
                 signal_2 += VALID_ARRAY;
                 
             
-                netlist << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
+                out << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
 
                 signal_1 = "end_out"; 
 
@@ -809,7 +858,7 @@ void write_connections (  int indx )
                 signal_2 += DATAOUT_ARRAY;
                 
             
-                netlist << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
+                out << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
                 
   
                 signal_1 = nodes[i].name;
@@ -820,7 +869,7 @@ void write_connections (  int indx )
             
                 signal_2 = "end_ready"; 
 
-                netlist << "\t"  << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
+                out << "\t"  << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
   
                 
             }
@@ -844,7 +893,7 @@ void write_connections (  int indx )
                         signal_2 += to_string( indx );;
 
                     
-                        netlist << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
 
                     }
                     
@@ -866,7 +915,7 @@ void write_connections (  int indx )
                         signal_2 += to_string( nodes[i].outputs.output[indx].next_nodes_port );
 
                         //outFile << "\t"  << signal_1 << nodes[i].outputs.output[indx].next_nodes_port << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
 
                         
                     }
@@ -890,7 +939,7 @@ void write_connections (  int indx )
                         //inverted
                         string inverted;
                         
-                        if ( nodes[nodes[i].outputs.output[indx].next_nodes_id].inputs.input[nodes[i].outputs.output[indx].next_nodes_port].type == "i" )
+                        if ( nodes[nodes[i].outputs.output[indx].next_nodes_id].inputs.input.get( nodes[i].outputs.output[indx].next_nodes_port ).type == "i" )
                         {
                             inverted = "not "; //inverted
                         }
@@ -908,13 +957,13 @@ void write_connections (  int indx )
                         if ( nodes[nodes[i].outputs.output[indx].next_nodes_id].type.find("Constant") != std::string::npos ) // Overwrite predecessor with constant value
                         {
                             signal_2 = "\"";
-                            signal_2 += string_constant ( nodes[nodes[i].outputs.output[indx].next_nodes_id].component_value , nodes[nodes[i].outputs.output[indx].next_nodes_id].inputs.input[0].bit_size );
+                            signal_2 += string_constant ( nodes[nodes[i].outputs.output[indx].next_nodes_id].component_value , nodes[nodes[i].outputs.output[indx].next_nodes_id].inputs.input.get( 0 ).bit_size );
                             signal_2 += "\"";                        
-                        netlist << "\t" << signal_1  << " <= " << signal_2 <<SEMICOLOUMN << endl;
+                        out << "\t" << signal_1  << " <= " << signal_2 <<SEMICOLOUMN << endl;
                     }
                         else
                         {
-                            netlist << "\t" << signal_1 << " <= " << inverted << "std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
+                            out << "\t" << signal_1 << " <= " << inverted << "std_logic_vector (resize(unsigned(" << signal_2 << ")," << signal_1 << "'length))"<<SEMICOLOUMN << endl;
                         }
                     }
                 }
@@ -924,12 +973,12 @@ void write_connections (  int indx )
     else
     {
         
-        for (int i = 0; i < components_in_netlist; i++ ) 
+        for (int i = first; i < last; i++ ) 
         {
-            netlist << endl;
+            out << endl;
             
-            netlist << "\t" << nodes[i].name << UNDERSCORE  << "clk" << " <= " << "clk" <<  SEMICOLOUMN << endl;
-            netlist << "\t" << nodes[i].name << UNDERSCORE  << "rst" << " <= " << "rst" <<  SEMICOLOUMN << endl;
+            out << "\t" << nodes[i].name << UNDERSCORE  << "clk" << " <= " << "clk" <<  SEMICOLOUMN << endl;
+            out << "\t" << nodes[i].name << UNDERSCORE  << "rst" << " <= " << "rst" <<  SEMICOLOUMN << endl;
                 
             
             if ( nodes[i].type == "Entry" )
@@ -949,7 +998,7 @@ void write_connections (  int indx )
                     signal_2 += UNDERSCORE;
                     signal_2 +="data";
                     
-                    netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
+                    out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;                
                 }
                 
                 signal_1 = nodes[i].name;
@@ -961,14 +1010,14 @@ void write_connections (  int indx )
             
                 signal_2 = "ap_start";
 
-                netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
+                out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
     
             }
             
             
             for ( int indx = 0; indx < nodes[i].inputs.size; indx++ )
             {
-                    cout << nodes[i].name <<  "prev_node_id" << nodes[i].inputs.input[indx].prev_nodes_id << endl;
+                    messages << nodes[i].name <<  "prev_node_id" << nodes[i].inputs.input[indx].prev_nodes_id << endl;
                     if ( nodes[i].inputs.input[indx].prev_nodes_id == COMPONENT_NOT_FOUND )
                     {
                         signal_1 = nodes[i].name;
@@ -983,7 +1032,7 @@ void write_connections (  int indx )
                         signal_2 += ")";
    
                         
-                        netlist << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
                         
                         signal_1 = nodes[i].name;
                         signal_1 += UNDERSCORE;
@@ -997,7 +1046,7 @@ void write_connections (  int indx )
                         signal_2 += ")";
    
                         
-                        netlist << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1 << " <= " << signal_2 << SEMICOLOUMN << endl;
                                                 
                         signal_2 = READY_ARRAY;
                         signal_2 += "(";
@@ -1011,7 +1060,7 @@ void write_connections (  int indx )
                         signal_1 += to_string( indx );
 
                         
-                        netlist << "\t"  << signal_2 << " <= " << signal_1 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_2 << " <= " << signal_1 << SEMICOLOUMN << endl;
                         
                             
                     }
@@ -1033,7 +1082,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += VALID_ARRAY;
                     
-                        netlist << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1 << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
 
 //                     }
 //                     
@@ -1055,7 +1104,7 @@ void write_connections (  int indx )
                         signal_2 += to_string( nodes[i].outputs.output[indx].next_nodes_port );
 
                         //outFile << "\t"  << signal_1 << nodes[i].outputs.output[indx].next_nodes_port << " <= " << signal_2 << UNDERSCORE << indx <<SEMICOLOUMN << endl;
-                        netlist << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
+                        out << "\t"  << signal_1  << " <= " << signal_2 << SEMICOLOUMN << endl;
 
                         
                     }                    
@@ -1088,13 +1137,13 @@ void write_connections (  int indx )
                             //cout << " ******size" << nodes[nodes[i].outputs.output[indx].next_nodes_id].outputs.output[0].bit_size / 4<< endl;
                             //ss << setfill('0') << setw(8) << hex << nodes[nodes[i].outputs.output[indx].next_nodes_id].component_value;
                             int fill_value = 8;
-                            fill_value = nodes[nodes[i].outputs.output[indx].next_nodes_id].outputs.output[0].bit_size / 4 ;
+                            fill_value = nodes[nodes[i].outputs.output[indx].next_nodes_id].outputs.output.get( 0 ).bit_size / 4 ;
                             ss << setfill('0') << setw( fill_value ) << hex << nodes[nodes[i].outputs.output[indx].next_nodes_id].component_value;
                             string val = ss.str();
                             signal_2 += val;
                             signal_2 += "\"";                        
                         }
-                        netlist << "\t" << signal_1  << " <= " << signal_2 <<SEMICOLOUMN << endl;
+                        out << "\t" << signal_1  << " <= " << signal_2 <<SEMICOLOUMN << endl;
                     }
                     else
                     {
@@ -1110,7 +1159,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += to_string(indx);
                         
-                        netlist << "\t" << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
+                        out << "\t" << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
 
                         signal_1 = VALID_ARRAY; 
                         signal_1 += "(";
@@ -1123,7 +1172,7 @@ void write_connections (  int indx )
                         signal_2 += UNDERSCORE;
                         signal_2 += to_string(indx);
                         
-                        netlist << "\t" << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
+                        out << "\t" << signal_1 << " <= " << signal_2 <<SEMICOLOUMN << endl;
                         
                         
                     }
@@ -1134,6 +1183,15 @@ void write_connections (  int indx )
     }
 }
 
+void write_connections (  int indx )
+{
+    netlist << endl;
+
+    //netlist << "\t" << "ap_ready <= '1';" << endl;
+
+    write_nodes ( write_connections_nodes, indx );
+}
+
 string get_component_entity ( string component, int component_id )
 {
     string component_entity;
@@ -1590,7 +1648,7 @@ string get_generic ( int node_id )
     return generic;
 }
 
-void write_components ( )
+void write_components_nodes ( ostream& out, ostream& messages, int indx_unused, int first, int last )
 {
     string entity="";
     string generic="";
@@ -1599,10 +1657,10 @@ void write_components ( )
     string output_port="";
     string output_signal="";
     
-    for (int i = 0; i < components_in_netlist; i++) 
+    for (int i = first; i < last; i++) 
     {
         
-        netlist << endl;
+        out << endl;
         
         entity = nodes[i].name;
         entity += ": entity work.";
@@ -1631,31 +1689,31 @@ void write_components ( )
             
             generic += ")";
             
-            netlist << entity << generic << endl;
+            out << entity << generic << endl;
         }
         else
         {
-            netlist << entity << endl;
+            out << entity << endl;
         }
         
-        netlist << "port map (" << endl;
+        out << "port map (" << endl;
 
         if ( nodes[i].type != "LSQ" )
         {        
-            netlist << "\t" << "clk => " << nodes[i].name << "_clk";
-            netlist << COMMA << endl<< "\t" << "rst => " << nodes[i].name << "_rst";
+            out << "\t" << "clk => " << nodes[i].name << "_clk";
+            out << COMMA << endl<< "\t" << "rst => " << nodes[i].name << "_rst";
         }
         else
         {
-            netlist << "\t" << "clock => " << nodes[i].name << "_clk";
-            netlist << COMMA << endl<< "\t" << "reset => " << nodes[i].name << "_rst";
+            out << "\t" << "clock => " << nodes[i].name << "_clk";
+            out << COMMA << endl<< "\t" << "reset => " << nodes[i].name << "_rst";
             
             // Andrea 20200117 Added to be compatible with chisel LSQ
-            netlist << "," << endl;
+            out << "," << endl;
 //            netlist << "\t" << "io_memIsReadyForLoads => '1' ," << endl;
 //            netlist << "\t" << "io_memIsReadyForStores => '1' ";
-            netlist << "\t" << "io_memIsReadyForLoads => " <<  nodes[i].name << "_load_ready" << COMMA << endl;
-            netlist << "\t" << "io_memIsReadyForStores => " <<  nodes[i].name << "_store_ready";
+            out << "\t" << "io_memIsReadyForLoads => " <<  nodes[i].name << "_load_ready" << COMMA << endl;
+            out << "\t" << "io_memIsReadyForStores => " <<  nodes[i].name << "_store_ready";
             
         }
         int indx = 0;
@@ -1691,11 +1749,11 @@ void write_components ( )
         if ( nodes[i].type == "LSQ" || nodes[i].type == "MC" )
         {
             
-                static int load_indx = 0;
+                int load_indx = 0;
                 load_indx = 0;
                 
-                static int store_add_indx = 0;
-                static int store_data_indx = 0;
+                int store_add_indx = 0;
+                int store_data_indx = 0;
                 store_add_indx = 0;
                 store_data_indx = 0;
                 
@@ -1709,7 +1767,7 @@ void write_components ( )
                     //cout << nodes[i].name << "LSQ output "<< lsq_indx << " = " << nodes[i].outputs.output[lsq_indx].type << " port = " << nodes[i].outputs.output[lsq_indx].port << " info_type = " <<nodes[i].outputs.output[lsq_indx].info_type << endl;     
                 }
 
-                netlist << "," << endl;
+                out << "," << endl;
                 
                 if ( nodes[i].type == "LSQ" )
                 {
@@ -1723,7 +1781,7 @@ void write_components ( )
                 input_signal += "dout0";
                 input_signal += COMMA;
                 
-                netlist << "\t" << "io_storeDataOut" << " => "   << input_signal << endl;
+                out << "\t" << "io_storeDataOut" << " => "   << input_signal << endl;
 
                 if ( nodes[i].type == "LSQ" )
                 {
@@ -1737,14 +1795,14 @@ void write_components ( )
                 input_signal += "address0";
                 input_signal += COMMA;
 
-                netlist << "\t" << "io_storeAddrOut" << " => "  << input_signal << endl;
+                out << "\t" << "io_storeAddrOut" << " => "  << input_signal << endl;
                 
                 input_signal = nodes[i].name;
                 input_signal += UNDERSCORE;
                 input_signal += "we0_ce0";
                 input_signal += COMMA;
 
-                netlist << "\t" << "io_storeEnable"<< " => "  << input_signal << endl;
+                out << "\t" << "io_storeEnable"<< " => "  << input_signal << endl;
                 
                 if ( nodes[i].type == "LSQ" )
                 {
@@ -1758,7 +1816,7 @@ void write_components ( )
                 input_signal += "din1";
                 input_signal += COMMA;
 
-                netlist << "\t" << "io_loadDataIn" << " => "  << input_signal << endl;
+                out << "\t" << "io_loadDataIn" << " => "  << input_signal << endl;
                 
                 if ( nodes[i].type == "LSQ" )
                 {
@@ -1772,7 +1830,7 @@ void write_components ( )
                 input_signal += "address1";
                 input_signal += COMMA;
 
-                netlist << "\t" << "io_loadAddrOut"<< " => "  << input_signal  << endl;
+                out << "\t" << "io_loadAddrOut"<< " => "  << input_signal  << endl;
                 
                 if ( nodes[i].type == "LSQ" )
                 {
@@ -1786,7 +1844,7 @@ void write_components ( )
                 input_signal += "ce1";
                 //input_signal += COMMA;
                 
-                netlist << "\t" << "io_loadEnable" << " => "  << input_signal;
+                out << "\t" << "io_loadEnable" << " => "  << input_signal;
 
                 
 
@@ -1803,7 +1861,7 @@ void write_components ( )
             string stDataValidPrev = "";
             string stDataBitsPrev = "";
 
-            netlist << COMMA << endl;
+            out << COMMA << endl;
             for ( int lsq_indx = 0; lsq_indx < nodes[i].inputs.size; lsq_indx++ )
             {    
                 //cout << nodes[i].name; 
@@ -2270,18 +2328,18 @@ void write_components ( )
                             
             }
 
-            netlist << bbReadyPrev;
-            netlist << bbValidPrev;
-            netlist << bbCountPrev;
-            netlist << rdReadyPrev;
-            netlist << rdValidPrev;
-            netlist << rdBitsPrev;
-            netlist << stAdReadyPrev;
-            netlist << stAdValidPrev;
-            netlist << stAdBitsPrev;
-            netlist << stDataReadyPrev;
-            netlist << stDataValidPrev;
-            netlist << stDataBitsPrev;
+            out << bbReadyPrev;
+            out << bbValidPrev;
+            out << bbCountPrev;
+            out << rdReadyPrev;
+            out << rdValidPrev;
+            out << rdBitsPrev;
+            out << stAdReadyPrev;
+            out << stAdValidPrev;
+            out << stAdBitsPrev;
+            out << stDataReadyPrev;
+            out << stDataValidPrev;
+            out << stDataBitsPrev;
 
             string rdReadyNext = "";
             string rdValidNext = "";
@@ -2297,7 +2355,7 @@ void write_components ( )
                 if ( nodes[i].outputs.output[lsq_indx].type == "c" )
                 {
                     //LANA REMOVE???
-                    netlist << COMMA << endl;
+                    out << COMMA << endl;
                     input_port = "io";
                     input_port += UNDERSCORE;
                     input_port += "bbValids";
@@ -2311,7 +2369,7 @@ void write_components ( )
                     input_signal += to_string(lsq_indx);
                     input_signal += COMMA;
 
-                    netlist << "\t" << input_port << " => "  << input_signal << endl;
+                    out << "\t" << input_port << " => "  << input_signal << endl;
 
                     
                     input_port = "io";
@@ -2327,7 +2385,7 @@ void write_components ( )
                     input_signal += to_string(lsq_indx);
                     //input_signal += COMMA;
 
-                    netlist << "\t" << input_port << " => "  << input_signal;
+                    out << "\t" << input_port << " => "  << input_signal;
 
                     
                 }
@@ -2456,8 +2514,8 @@ void write_components ( )
                 if ( nodes[i].outputs.output[lsq_indx].type == "s" )
                 {
                     //LANA REMOVE???
-                    netlist << COMMA << endl;
-                    static int store_indx = 0;
+                    out << COMMA << endl;
+                    int store_indx = 0;
 
                     input_port = "io";
                     input_port += UNDERSCORE;
@@ -2475,7 +2533,7 @@ void write_components ( )
                     input_signal += to_string(lsq_indx);
                     input_signal += COMMA;
 
-                    netlist << "\t" << input_port << " => "  << input_signal << endl;
+                    out << "\t" << input_port << " => "  << input_signal << endl;
 
                     
                     input_port = "io";
@@ -2493,7 +2551,7 @@ void write_components ( )
                     input_signal += to_string(lsq_indx);
                     //input_signal += COMMA;
 
-                    netlist << "\t" << input_port << " => "  << input_signal;
+                    out << "\t" << input_port << " => "  << input_signal;
                     
                     store_indx++;
 
@@ -2503,7 +2561,7 @@ void write_components ( )
                 {
                     
                     //netlist << COMMA << endl;
-                    static int store_indx = 0;
+                    int store_indx = 0;
 
                     input_port = "io";
                     input_port += UNDERSCORE;
@@ -2544,14 +2602,14 @@ void write_components ( )
                             
             }
 
-            netlist << rdReadyNext;
-            netlist << rdValidNext;
-            netlist << rdBitsNext;
-            netlist << emptyValid;
+            out << rdReadyNext;
+            out << rdValidNext;
+            out << rdBitsNext;
+            out << emptyValid;
             
             if ( nodes[i].type != "LSQ" ) // Andrea 20200117 Added to be compatible with chisel LSQ
             {
-                netlist << emptyReady;
+                out << emptyReady;
                 
             }
 
@@ -2583,7 +2641,7 @@ void write_components ( )
                     input_signal += components_type[nodes[i].component_type].in_ports_name_str[0];
                     input_signal += UNDERSCORE;
                     input_signal += to_string(indx);
-                    netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                    out << COMMA << endl << "\t" << input_port << " => " << input_signal;
                 }
             }
             for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
@@ -2619,7 +2677,7 @@ void write_components ( )
                 {
                 //    input_signal = "\'0\', --Andrea forced to 0 to run the simulation";
                 }
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
             {
@@ -2646,7 +2704,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string(indx);
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             
             //netlist << COMMA << endl << "\t" << "ap_done" << " => " << "ap_done";
@@ -2663,7 +2721,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += "0";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             
 
                 
@@ -2680,7 +2738,7 @@ void write_components ( )
                 input_signal += "0";
 
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = NREADY_ARRAY;
                 input_port += "(";
@@ -2694,7 +2752,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += "0";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
 
 
@@ -2731,7 +2789,7 @@ void write_components ( )
                     input_signal += components_type[nodes[i].component_type].in_ports_name_str[0];
                     input_signal += UNDERSCORE;
                     input_signal += to_string(indx);
-                    netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                    out << COMMA << endl << "\t" << input_port << " => " << input_signal;
                 }
             }
             for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
@@ -2767,7 +2825,7 @@ void write_components ( )
                 {
                 //    input_signal = "\'0\', --Andrea forced to 0 to run the simulation";
                 }
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
             {
@@ -2794,7 +2852,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string(indx);
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             
             //netlist << COMMA << endl << "\t" << "ap_done" << " => " << "ap_done";
@@ -2811,7 +2869,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += "0";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             
 
                 
@@ -2828,7 +2886,7 @@ void write_components ( )
                 input_signal += "0";
 
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = NREADY_ARRAY;
                 input_port += "(";
@@ -2842,7 +2900,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += "0";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
                 
 
         }
@@ -2903,7 +2961,7 @@ void write_components ( )
                     input_signal += UNDERSCORE;
                     input_signal += to_string( indx );
                     
-                    netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                    out << COMMA << endl << "\t" << input_port << " => " << input_signal;
                 }
             }
             
@@ -2951,7 +3009,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string( indx );
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
 
             for ( indx = 0; indx < nodes[i].inputs.size; indx++ )
@@ -2995,7 +3053,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string( indx );
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             
             
@@ -3009,7 +3067,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "read_enable";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = "read_address";
                 
@@ -3017,7 +3075,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "read_address";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = "data_from_memory";
                 
@@ -3025,7 +3083,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "data_from_memory";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             
         
@@ -3037,7 +3095,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "write_enable";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = "write_address";
                 
@@ -3045,7 +3103,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "write_address";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
 
                 input_port = "data_to_memory";
                 
@@ -3053,7 +3111,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal +=  "data_to_memory";
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
 
             
@@ -3073,7 +3131,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string( indx );
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             for ( indx = 0; indx < nodes[i].outputs.size; indx++ )
             {            
@@ -3090,7 +3148,7 @@ void write_components ( )
                 input_signal += UNDERSCORE;
                 input_signal += to_string( indx );
                 
-                netlist << COMMA << endl << "\t" << input_port << " => " << input_signal;
+                out << COMMA << endl << "\t" << input_port << " => " << input_signal;
             }
             for ( indx = 0; indx < nodes[i].outputs.size; indx++ )
             {            
@@ -3142,7 +3200,7 @@ void write_components ( )
                     //    output_signal.erase( remove( output_signal.begin(), output_signal.end(), ',' ), output_signal.end() );
                     //}
                     
-                    netlist << COMMA << endl << "\t" << output_port << " => " << output_signal;
+                    out << COMMA << endl << "\t" << output_port << " => " << output_signal;
                 }
             }
             
@@ -3182,16 +3240,21 @@ void write_components ( )
                     input_signal += string_constant(value, index_size);
                     input_signal += "\"";
 
-                    netlist << COMMA << endl
+                    out << COMMA << endl
                             << "\t" << input_port << " => " << input_signal;
                 }
             }
         }
-            netlist << endl << ");" << endl;
+            out << endl << ");" << endl;
 
     }
 }
 
+void write_components ( )
+{
+    write_nodes ( write_components_nodes, 0 );
+}
+
 
 
 int get_end_bitsize( void )
@@ -7,65 +7,65 @@
 
 #include "GraphToVerilog.h"
 
-//Constructor
-//GraphToVerilog::GraphToVerilog(DotReader dotReader){
-GraphToVerilog::GraphToVerilog(std::string filen){
-	//	this->dotReader = dotReader;
-
-	DotReader dotReader(filen);
-	dotReader.lineReader();
-	this->dotReader = dotReader;
-	std::cout << "Dot Read for Verilog" << std::endl;
+//Size of the buffer of the output file
+static const int OUTPUT_BUFFER_SIZE = 1 << 20;
 
-	verilogCode = "";
+//Constructor
+GraphToVerilog::GraphToVerilog(DotReader& dotReader) : dotReader(dotReader){
 	tabs = "";
 }
 
 
 void GraphToVerilog::writeToFile(){
 	std::string file_n = dotReader.getFileName() + ".v";
-	std::ofstream outStream(file_n);
-	writeVerilogCode();
-	outStream << getVerilogCode() << std::endl;
+
+	//The buffer must be set before opening the file
+	std::vector<char> buffer(OUTPUT_BUFFER_SIZE);
+	std::ofstream outStream;
+	outStream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+	outStream.open(file_n);
+
+	writeVerilogCode(outStream);
+	outStream << std::endl;
 
 	outStream.close();
 }
 
-//Function that calls other functions to append their generated verilog code snippet
+//Function that calls other functions to write their generated verilog code snippet
 //The sequence in which the sub-functions are called determines in which sequence the snippet
 //will appear in the final code.
 //Eg. Module Name is the first thing of a verilog code
 //Followed by Top Module Ports Input output declarations
 //Followed by declaring wires that connect various sub components in the top module
-void GraphToVerilog::writeVerilogCode(){
-	verilogCode += writeTopModuleName();
+void GraphToVerilog::writeVerilogCode(std::ostream& out){
+	writeTopModuleName(out);
 
 	insertTab();
-	verilogCode += writeTopModulePorts();
+	writeTopModulePorts(out);
 	removeTab();
 
+	//Declaring the wires also sets up the connections of the components,
+	//hence it must be written before the connections and the instantiations
 	insertTab();
-	verilogCode += writeModulePortWires();
+	writeModulePortWires(out);
 	removeTab();
 
 
 	insertTab();
-	verilogCode += writeInputOutputConnections();
+	writeInputOutputConnections(out);
 	removeTab();
 
 
 	insertTab();
-	verilogCode += writeModuleInstantiation();
+	writeModuleInstantiation(out);
 	removeTab();
 
-	verilogCode += writeEndModule();
+	writeEndModule(out);
 }
 
 
 //Declares the top module.
-std::string GraphToVerilog::writeTopModuleName(){
-	std::string moduleName;
-
+void GraphToVerilog::writeTopModuleName(std::ostream& out){
 	std::string filennn = dotReader.getFileName();
 
 	unsigned long pos = filennn.rfind("_optimized");
@@ -74,9 +74,7 @@ std::string GraphToVerilog::writeTopModuleName(){
 		filennn = substring(filennn, 0, pos);
 	}
 
-	moduleName = "module " + filennn + "(\n";
-
-	return moduleName;
+	out << "module " << filennn << "(\n";
 }
 
 //This function populates the topModulePortComponents which will contain
@@ -101,7 +99,9 @@ void GraphToVerilog::generateTopModulePortComponents(){
 //3. LSQ
 //4. MC
 
-std::string GraphToVerilog::writeTopModulePorts(){
+void GraphToVerilog::writeTopModulePorts(std::ostream& out){
+	//Only a few components have ports in the top module, the list is built in a string
+	//to drop its last comma before writing it
 	std::string topModulePortList;
 	generateTopModulePortComponents();
 
@@ -133,7 +133,7 @@ std::string GraphToVerilog::writeTopModulePorts(){
 
 	topModulePortList += ");\n\n";
 
-	return topModulePortList;
+	out << topModulePortList;
 }
 
 
@@ -144,298 +144,135 @@ std::string GraphToVerilog::writeTopModulePorts(){
 //They include the data, valid and ready signal for all input and outputs of that component
 //Additional ports can be added if needed for a particular component by overriding getModulePortDeclarations
 //function in a sub class
-std::string GraphToVerilog::writeModulePortWires(){
-	std::string modulePortWires;
-
+void GraphToVerilog::writeModulePortWires(std::ostream& out){
 	for(auto it = dotReader.getComponentList().begin(); it != dotReader.getComponentList().end(); it++){
-		modulePortWires += (*it)->getModulePortDeclarations(tabs);
-		modulePortWires += "\n";
+		out << (*it)->getModulePortDeclarations(tabs) << "\n";
 	}
-
-	return modulePortWires;
 }
 
 
-std::string GraphToVerilog::writeModuleInstantiation(){
-	std::string moduleInstances = "";
-
+void GraphToVerilog::writeModuleInstantiation(std::ostream& out){
 	for(auto it = dotReader.getComponentList().begin(); it != dotReader.getComponentList().end(); it++){
-		if((*it)->type == COMPONENT_START){
-			moduleInstances += ((StartComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_END){
-			moduleInstances += ((EndComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_FORK){
-			moduleInstances += ((ForkComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_OPERATOR){
-			if((*it)->op == OPERATOR_ADD){
-				moduleInstances += ((AddComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SUB){
-				moduleInstances += ((SubComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_MUL){
-				moduleInstances += ((MulComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_UREM){
-				moduleInstances += ((RemComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_AND){
-				moduleInstances += ((AndComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_OR){
-				moduleInstances += ((OrComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_XOR){
-				moduleInstances += ((XorComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SHL){
-				moduleInstances += ((ShlComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_LSHR){
-				moduleInstances += ((LshrComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_ASHR){
-				moduleInstances += ((AshrComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_EQ){
-				moduleInstances += ((EqComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_NE){
-				moduleInstances += ((NeComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_UGT){
-				moduleInstances += ((UgtComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_UGE){
-				moduleInstances += ((UgeComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SGT){
-				moduleInstances += ((SgtComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SGE){
-				moduleInstances += ((SgeComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_ULT){
-				moduleInstances += ((UltComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_ULE){
-				moduleInstances += ((UleComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SLT){
-				moduleInstances += ((SltComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SLE){
-				moduleInstances += ((SleComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SEXT || (*it)->op == OPERATOR_ZEXT){
-				moduleInstances += ((SZextComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_GETPTR){
-				moduleInstances += ((GetPtrComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_RET){
-				moduleInstances += ((RetComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_SELECT){
-				moduleInstances += ((SelectComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_READ_MEMORY){
-				moduleInstances += ((LoadComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_WRITE_MEMORY){
-				moduleInstances += ((StoreComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			} else if((*it)->op == OPERATOR_WRITE_LSQ || (*it)->op == OPERATOR_READ_LSQ){
-				moduleInstances += ((LSQControllerComponent*)(*it))->getModuleInstantiation(tabs);
-				moduleInstances += "\n\n";
-			}
-		} else if((*it)->type == COMPONENT_SOURCE){
-			moduleInstances += ((SourceComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_SINK){
-			moduleInstances += ((SinkComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_CONSTANT_){
-			moduleInstances += ((ConstantComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_CTRLMERGE){
-			moduleInstances += ((ControlMergeComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_MERGE){
-			moduleInstances += ((MergeComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_BUF || (*it)->type == COMPONENT_TEHB || (*it)->type == COMPONENT_OEHB){
-			moduleInstances += ((BufferComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_MUX){
-			moduleInstances += ((MuxComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_BRANCH){
-			moduleInstances += ((BranchComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_MC){
-			moduleInstances += ((MemoryContentComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_TFIFO || (*it)->type == COMPONENT_NFIFO){
-			moduleInstances += ((FIFOComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		} else if((*it)->type == COMPONENT_LSQ){
-			moduleInstances += ((LSQComponent*)(*it))->getModuleInstantiation(tabs);
-			moduleInstances += "\n\n";
-		}
+		writeComponentCode(out, *it, MODULE_INSTANTIATION);
 	}
-
-	return moduleInstances;
 }
 
 
-std::string GraphToVerilog::writeInputOutputConnections(){
-	std::string inputoutput = "\n\n";
+void GraphToVerilog::writeInputOutputConnections(std::ostream& out){
+	out << "\n\n";
 
 	for(auto it = dotReader.getComponentList().begin(); it != dotReader.getComponentList().end(); it++){
-		if((*it)->type == COMPONENT_START){
-			inputoutput += ((StartComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_END){
-			inputoutput += ((EndComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_FORK){
-			inputoutput += ((ForkComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_OPERATOR){
-			if((*it)->op == OPERATOR_ADD){
-				inputoutput += ((AddComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SUB){
-				inputoutput += ((SubComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_MUL){
-				inputoutput += ((MulComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_UREM){
-				inputoutput += ((RemComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_AND){
-				inputoutput += ((AndComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_OR){
-				inputoutput += ((OrComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_XOR){
-				inputoutput += ((XorComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SHL){
-				inputoutput += ((ShlComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_LSHR){
-				inputoutput += ((LshrComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_ASHR){
-				inputoutput += ((AshrComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_EQ){
-				inputoutput += ((EqComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_NE){
-				inputoutput += ((NeComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_UGT){
-				inputoutput += ((UgtComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_UGE){
-				inputoutput += ((UgeComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SGT){
-				inputoutput += ((SgtComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SGE){
-				inputoutput += ((SgeComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_ULT){
-				inputoutput += ((UltComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_ULE){
-				inputoutput += ((UleComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SLT){
-				inputoutput += ((SltComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SLE){
-				inputoutput += ((SleComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SEXT || (*it)->op == OPERATOR_ZEXT){
-				inputoutput += ((SZextComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_GETPTR){
-				inputoutput += ((GetPtrComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_RET){
-				inputoutput += ((RetComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_SELECT){
-				inputoutput += ((SelectComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_READ_MEMORY){
-				inputoutput += ((LoadComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_WRITE_MEMORY){
-				inputoutput += ((StoreComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			} else if((*it)->op == OPERATOR_WRITE_LSQ || (*it)->op == OPERATOR_READ_LSQ){
-				inputoutput += ((LSQControllerComponent*)(*it))->getInputOutputConnections();
-				inputoutput += "\n";
-			}
-		} else if((*it)->type == COMPONENT_SOURCE){
-			inputoutput += ((SourceComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_SINK){
-			inputoutput += ((SinkComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_CONSTANT_){
-			inputoutput += ((ConstantComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_CTRLMERGE){
-			inputoutput += ((ControlMergeComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_MERGE){
-			inputoutput += ((MergeComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_BUF || (*it)->type == COMPONENT_TEHB || (*it)->type == COMPONENT_OEHB){
-			inputoutput += ((BufferComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_MUX){
-			inputoutput += ((MuxComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_BRANCH){
-			inputoutput += ((BranchComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_MC){
-			inputoutput += ((MemoryContentComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_TFIFO || (*it)->type == COMPONENT_NFIFO){
-			inputoutput += ((FIFOComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		} else if((*it)->type == COMPONENT_LSQ){
-			inputoutput += ((LSQComponent*)(*it))->getInputOutputConnections();
-			inputoutput += "\n";
-		}
+		writeComponentCode(out, *it, INPUT_OUTPUT_CONNECTIONS);
 	}
-
-	return inputoutput;
 }
 
 
-std::string GraphToVerilog::writeEndModule(){
-	return "endmodule\n";
+//getModuleInstantiation and getInputOutputConnections are redefined by the sub classes,
+//so they are called through the class of the component
+template<typename T>
+static void writeCode(std::ostream& out, Component* component, bool instantiation, std::string& tabs){
+	T* c = (T*)component;
+	if(instantiation){
+		out << c->getModuleInstantiation(tabs) << "\n\n";
+	} else{
+		out << c->getInputOutputConnections() << "\n";
+	}
 }
 
-//Till now, a useless function
-void GraphToVerilog::insertVerilogCode(std::string& str){
-	str = tabs + str + '\n';
-	verilogCode += str;
+//Components of an unknown type or operation are not written
+void GraphToVerilog::writeComponentCode(std::ostream& out, Component* component, ComponentCode code){
+	bool instantiation = code == MODULE_INSTANTIATION;
+
+	if(component->type == COMPONENT_START){
+		writeCode<StartComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_END){
+		writeCode<EndComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_FORK){
+		writeCode<ForkComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_OPERATOR){
+		if(component->op == OPERATOR_ADD){
+			writeCode<AddComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SUB){
+			writeCode<SubComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_MUL){
+			writeCode<MulComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_UREM){
+			writeCode<RemComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_AND){
+			writeCode<AndComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_OR){
+			writeCode<OrComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_XOR){
+			writeCode<XorComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SHL){
+			writeCode<ShlComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_LSHR){
+			writeCode<LshrComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_ASHR){
+			writeCode<AshrComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_EQ){
+			writeCode<EqComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_NE){
+			writeCode<NeComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_UGT){
+			writeCode<UgtComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_UGE){
+			writeCode<UgeComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SGT){
+			writeCode<SgtComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SGE){
+			writeCode<SgeComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_ULT){
+			writeCode<UltComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_ULE){
+			writeCode<UleComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SLT){
+			writeCode<SltComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SLE){
+			writeCode<SleComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SEXT || component->op == OPERATOR_ZEXT){
+			writeCode<SZextComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_GETPTR){
+			writeCode<GetPtrComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_RET){
+			writeCode<RetComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_SELECT){
+			writeCode<SelectComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_READ_MEMORY){
+			writeCode<LoadComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_WRITE_MEMORY){
+			writeCode<StoreComponent>(out, component, instantiation, tabs);
+		} else if(component->op == OPERATOR_WRITE_LSQ || component->op == OPERATOR_READ_LSQ){
+			writeCode<LSQControllerComponent>(out, component, instantiation, tabs);
+		}
+	} else if(component->type == COMPONENT_SOURCE){
+		writeCode<SourceComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_SINK){
+		writeCode<SinkComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_CONSTANT_){
+		writeCode<ConstantComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_CTRLMERGE){
+		writeCode<ControlMergeComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_MERGE){
+		writeCode<MergeComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_BUF || component->type == COMPONENT_TEHB || component->type == COMPONENT_OEHB){
+		writeCode<BufferComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_MUX){
+		writeCode<MuxComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_BRANCH){
+		writeCode<BranchComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_MC){
+		writeCode<MemoryContentComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_TFIFO || component->type == COMPONENT_NFIFO){
+		writeCode<FIFOComponent>(out, component, instantiation, tabs);
+	} else if(component->type == COMPONENT_LSQ){
+		writeCode<LSQComponent>(out, component, instantiation, tabs);
+	}
+}
+
+
+void GraphToVerilog::writeEndModule(std::ostream& out){
+	out << "endmodule\n";
 }
 
 
@@ -447,4 +284,3 @@ void GraphToVerilog::removeTab(){
 	if(tabs.size() != 0)
 		tabs = tabs.erase(0, 1);
 }
-
@@ -14,40 +14,40 @@
 
 class GraphToVerilog{
 public:
-//	GraphToVerilog(DotReader dotReader);
-	GraphToVerilog(std::string filen);
+	//The reader is not copied, it must outlive the GraphToVerilog object
+	GraphToVerilog(DotReader& dotReader);
 
 
-	void writeVerilogCode();
+	//Streams the whole top module to out, section by section
+	void writeVerilogCode(std::ostream& out);
 	void writeToFile();
 
-	std::string& getVerilogCode() {
-		return verilogCode;
-	}
-
 private:
-	DotReader dotReader;
+	DotReader& dotReader;
 	std::string tabs = "";
-	std::string verilogCode = "";
 	std::vector<Component*> topModulePortComponents;
 
+	//Which code of a component writeComponentCode writes
+	enum ComponentCode {MODULE_INSTANTIATION, INPUT_OUTPUT_CONNECTIONS};
+
 	void insertTab();
 	void removeTab();
-	void insertVerilogCode(std::string& str);
 	//Writes port list for top module
-	std::string writeTopModulePorts();
+	void writeTopModulePorts(std::ostream& out);
 	//Generates a list of components which interface with top module port list
 	void generateTopModulePortComponents();
 	//writes wires that interconnect various modules inside top module
-	std::string writeModulePortWires();
-	//returns Instantiation all the modules present in the Design
-	std::string writeModuleInstantiation();
-	//returns verilog code connecting various input and outputs of components together
-	std::string writeInputOutputConnections();
+	void writeModulePortWires(std::ostream& out);
+	//writes Instantiation all the modules present in the Design
+	void writeModuleInstantiation(std::ostream& out);
+	//writes verilog code connecting various input and outputs of components together
+	void writeInputOutputConnections(std::ostream& out);
+	//Writes the instantiation or the connections of a single component
+	void writeComponentCode(std::ostream& out, Component* component, ComponentCode code);
 	//Writes "module <name>("
-	std::string writeTopModuleName();
+	void writeTopModuleName(std::ostream& out);
 	//Writes "endmodule;"
-	std::string writeEndModule();
+	void writeEndModule(std::ostream& out);
 };
 
 #endif /* GRAPHTOVERILOG_H_ */
@@ -69,7 +69,10 @@ void arguments_parser ( int argc, char *argv[] )
 			if ( ! ( strcmp(argv[1] , "--help") ) )
 			{
 				printf ("Dot2Vhdl version %s \n\r", VERSION_STRING );
-				printf ( "Usage: %s filename -debug [opt]\n\r\n\r\n\r", argv[0]);
+				printf ( "Usage: %s filename -debug [opt]\n\r", argv[0]);
+				printf ( "       %s filename.dfb (reads the binary netlist instead of filename.dot)\n\r", argv[0]);
+				printf ( "       %s --bench_parse (parses a synthetic netlist with 50k edges)\n\r", argv[0]);
+				printf ( "Set DOT2HDL_LSQ_JOBS=N to run up to N LSQ generators at the same time (default 2)\n\r\n\r\n\r");
 				exit(1);
 
 			}
@@ -82,6 +85,12 @@ void arguments_parser ( int argc, char *argv[] )
 					exit(1);
 
 				}
+				else
+					if ( ! ( strcmp(argv[1] , "--bench_parse") ) )
+					{
+						benchmark_parse_dot ( 50000 );
+						exit(0);
+					}
 		break;
 	default:
 		printf( "Invalid arguments \n\rTry %s --help for more informations\n\r\n\r\n\r", argv[0] );
@@ -109,6 +118,10 @@ int main( int argc, char* argv[] )
 	dot_input_files = (argc-1);
 		    
 	top_level_filename = argv[1];
+	if ( is_binary_netlist ( top_level_filename ) )
+	{
+		top_level_filename.erase ( top_level_filename.rfind ( '.' ) );
+	}
 
 	for ( int indx = 0; indx < dot_input_files; indx++ )
 	{
@@ -116,11 +129,25 @@ int main( int argc, char* argv[] )
 		input_filename[indx] = argv[indx+1];
 		output_filename[indx] = argv[indx+1];
 
-		cout << "Parsing "<< input_filename[indx] << ".dot" << endl;
+		// A binary netlist (<name>.dfb) is read instead of <name>.dot. The VHDL and
+		// Verilog writers both use the parsed netlist, and the output names are the same
+		if ( is_binary_netlist ( input_filename[indx] ) )
+		{
+			cout << "Parsing "<< input_filename[indx] << endl;
 
-//		filename = string(input_filename[indx]);
+			parse_dot ( input_filename[indx] );
 
-		parse_dot ( input_filename[indx] );
+			input_filename[indx].erase ( input_filename[indx].rfind ( '.' ) );
+			output_filename[indx] = input_filename[indx];
+		}
+		else
+		{
+			cout << "Parsing "<< input_filename[indx] << ".dot" << endl;
+
+//			filename = string(input_filename[indx]);
+
+			parse_dot ( input_filename[indx] );
+		}
 		check_netlist ( );
 		
 		
@@ -138,7 +165,10 @@ int main( int argc, char* argv[] )
 		    
 		    cout << "Generating " << output_filename[indx] << ".v" << endl;
 		    string filen = string(input_filename[indx]);
-		    GraphToVerilog g2v(filen);
+		    DotReader dotReader(filen);
+		    dotReader.lineReader();
+		    cout << "Dot Read for Verilog" << endl;
+		    GraphToVerilog g2v(dotReader);
 		    g2v.writeToFile();
 		}
 
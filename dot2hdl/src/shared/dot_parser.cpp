@@ -18,8 +18,11 @@
 #include <algorithm> 
 #include <list>
 #include <cctype>
+#include <chrono>
+#include <sstream>
 #include "assert.h"
 #include "dot_parser.h"
+#include "NetlistBinary.h"
 #include "vhdl_writer.h"
 #include <stdlib.h>     /* exit, EXIT_FAILURE */
 
@@ -28,7 +31,8 @@
 
 using namespace std;
 
-NODE_T nodes[MAX_NODES];
+vector<NODE_T> nodes;
+unordered_map<string, int> node_ids; // Component name -> index in nodes
 
 int components_in_netlist;
 int lsqs_in_netlist;
@@ -75,6 +79,38 @@ void printNode(NODE_T node){
 }
 
 
+int find_node ( const string& name )
+{
+	auto it = node_ids.find( name );
+	if ( it == node_ids.end() )
+	{
+		return COMPONENT_NOT_FOUND;
+	}
+	return it->second;
+}
+
+// Returns the highest N such that "<prefix>N" appears in str (0 if none)
+int get_port_count ( const string& str, const string& prefix )
+{
+	int count = 0;
+	string::size_type pos = str.find( prefix );
+	while ( pos != string::npos )
+	{
+		string::size_type first = pos + prefix.size();
+		string::size_type last = first;
+		while ( last < str.size() && isdigit( str[last] ) && last - first < 9 )
+		{
+			last++;
+		}
+		if ( last > first && str[first] != '0' )
+		{
+			count = max( count, stoi( str.substr( first, last - first ) ) );
+		}
+		pos = str.find( prefix, pos + 1 );
+	}
+	return count;
+}
+
 bool check_line ( string line )
 {
 
@@ -380,19 +416,7 @@ IN_T get_component_inputs ( string in , int components_in_netlist )
 
 	}
 
-	string test_string;
-
-	for ( int indx = MAX_INPUTS ; indx > 0; indx-- )
-	{
-		test_string = "in";
-		test_string += to_string(indx);
-		if ( par[1].find(test_string) != std::string::npos )
-		{
-			inputs.size = indx;
-			break;
-		}
-
-	}
+	inputs.size = get_port_count( par[1], "in" );
 
 	int input_indx = 0;
 
@@ -468,20 +492,7 @@ OUT_T get_component_outputs ( string parameters )
 
 	}
 
-	string test_string;
-
-
-	for ( int indx = MAX_OUTPUTS ; indx > 0; indx-- )
-	{
-		test_string = "out";
-		test_string += to_string(indx);
-		if ( parameters.find(test_string) != std::string::npos )
-		{
-			outputs.size = indx;
-			break;
-		}
-
-	}
+	outputs.size = get_port_count( parameters, "out" );
 
 	int output_indx = 0;
 
@@ -533,124 +544,161 @@ string get_component_name ( string name )
 
 }
 
-void parse_connections ( string line )
+// Returns line[first, last) without blanks and quotes, and without a leading '_'
+string get_edge_node_name ( const string& line, size_t first, size_t last )
 {
-
-	vector<string> v;
-	vector<string> from_to;
-	vector<string> parameters;
-
-
-	int current_node_id;
-	int next_node_id;
-
-	string_split(line, '>', v);
-
-	int i;
-	if ( v.size() > 0 )
+	string name;
+	for ( size_t indx = first; indx < last; indx++ )
 	{
-		v[0].erase( remove( v[0].begin(), v[0].end(), ' ' ), v[0].end() );
-		v[0].erase( remove( v[0].begin(), v[0].end(), '-' ), v[0].end() );
-		v[0].erase( remove( v[0].begin(), v[0].end(), '\t' ), v[0].end() );
-		v[0].erase( remove( v[0].begin(), v[0].end(), '"' ), v[0].end() );
+		char c = line[indx];
+		if ( c != ' ' && c != '\t' && c != '"' )
+		{
+			name += c;
+		}
+	}
+	if ( !name.empty() && name[0] == '_' )
+	{
+		name.erase(0, 1);
+	}
+	return name;
+}
 
-		string_split( v[1], '[', from_to );
-		from_to[0].erase( remove( from_to[0].begin(), from_to[0].end(), ' ' ), from_to[0].end() );
-		from_to[0].erase( remove( from_to[0].begin(), from_to[0].end(), '\t' ), from_to[0].end() );
-		from_to[0].erase( remove( from_to[0].begin(), from_to[0].end(), '"' ), from_to[0].end() );
+// Returns the number at the end of a port name (e.g. 2 for "out2")
+int get_edge_port ( const string& port )
+{
+	size_t first = 0;
+	while ( first < port.size() && !isdigit( port[first] ) )
+	{
+		first++;
+	}
+	return stoi_p( port.substr( first ) );
+}
 
-		if ( v[0][0] == '_' )
+// Tokenizes the attributes of an edge (key = "value", ...) in a single pass,
+// starting after the '['. Only the from/to ports are extracted.
+void get_edge_ports ( const string& line, size_t pos, int& output_indx, int& input_indx )
+{
+	while ( pos < line.size() && line[pos] != ']' )
+	{
+		// Key
+		while ( pos < line.size() && ( line[pos] == ' ' || line[pos] == '\t' || line[pos] == ',' ) )
 		{
-			v[0].replace(0,1,"");
+			pos++;
 		}
-
-		if ( from_to[0][0] == '_' )
+		size_t key_first = pos;
+		while ( pos < line.size() && line[pos] != '=' && line[pos] != ' ' && line[pos] != '\t' && line[pos] != ',' && line[pos] != ']' )
 		{
-			from_to[0].replace(0,1,"");
+			pos++;
 		}
+		string key = line.substr( key_first, pos - key_first );
+		while ( pos < line.size() && ( line[pos] == ' ' || line[pos] == '\t' ) )
+		{
+			pos++;
+		}
+		if ( pos >= line.size() || line[pos] != '=' )
+		{
+			continue;
+		}
+		pos++;
 
-
-		current_node_id = COMPONENT_NOT_FOUND;
-		for (i = 0; i < components_in_netlist; i++)
+		// Value (quoted or not)
+		while ( pos < line.size() && ( line[pos] == ' ' || line[pos] == '\t' ) )
+		{
+			pos++;
+		}
+		size_t value_first, value_last;
+		if ( pos < line.size() && line[pos] == '"' )
 		{
-			if ( nodes[i].name.compare(v[0]) == 0 )
+			value_first = ++pos;
+			while ( pos < line.size() && line[pos] != '"' )
+			{
+				pos++;
+			}
+			value_last = pos;
+			if ( pos < line.size() )
 			{
-				current_node_id = i;
-				break;
+				pos++;
 			}
 		}
-		next_node_id = COMPONENT_NOT_FOUND;
-
-		for (i = 0; i < components_in_netlist; i++)
+		else
 		{
-			if ( nodes[i].name.compare(from_to[0]) == 0 )
+			value_first = pos;
+			while ( pos < line.size() && line[pos] != ',' && line[pos] != ']' && line[pos] != ' ' && line[pos] != '\t' )
 			{
-				next_node_id = i;
-				break;
+				pos++;
 			}
+			value_last = pos;
 		}
 
-		string_split( from_to[1], ',', parameters );
-
-		int input_indx;
-		int output_indx;
-		int indx;
-		for ( indx = 0; indx < parameters.size(); indx++ )
+		if ( key == "from" )
 		{
-			if ( parameters[indx].find("from") != std::string::npos )
-			{
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), ' ' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), '\t' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), '"' ), parameters[indx].end() );
-				parameters[indx].erase(0, 8);
-				output_indx = stoi_p( parameters[indx] );
-				output_indx--;
-			}
-			if ( parameters[indx].find("to") != std::string::npos )
-			{
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), ' ' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), '\t' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), '"' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), ';' ), parameters[indx].end() );
-				parameters[indx].erase( remove( parameters[indx].begin(), parameters[indx].end(), ']' ), parameters[indx].end() );
+			output_indx = get_edge_port( line.substr( value_first, value_last - value_first ) ) - 1;
+		}
+		else if ( key == "to" )
+		{
+			input_indx = get_edge_port( line.substr( value_first, value_last - value_first ) ) - 1;
+		}
+	}
+}
 
+void parse_connections ( string line )
+{
+	// "src" -> "dst" [from = "outN", to = "inM", ...]
+	size_t arrow = line.find( "->" );
+	if ( arrow == string::npos )
+	{
+		return;
+	}
+	size_t attributes = line.find( '[', arrow );
+	if ( attributes == string::npos )
+	{
+		attributes = line.size();
+	}
 
-				parameters[indx].erase(0, 5);
+	string src_name = get_edge_node_name( line, 0, arrow );
+	string dst_name = get_edge_node_name( line, arrow + 2, attributes );
 
-				input_indx = stoi_p( parameters[indx] );
-				input_indx--;
-			}
+	int input_indx = COMPONENT_NOT_FOUND;
+	int output_indx = COMPONENT_NOT_FOUND;
+	get_edge_ports( line, attributes + 1, output_indx, input_indx );
 
-		}
+	connect_nodes( src_name, dst_name, output_indx, input_indx );
+}
 
-		if ( current_node_id != COMPONENT_NOT_FOUND && next_node_id != COMPONENT_NOT_FOUND )
-		{
+// Connects the output port of a node to the input port of another one
+void connect_nodes ( const string& src_name, const string& dst_name, int output_indx, int input_indx )
+{
+	int current_node_id = find_node( src_name );
+	int next_node_id = find_node( dst_name );
 
-			nodes[current_node_id].outputs.output[output_indx].next_nodes_id = next_node_id;
-			nodes[current_node_id].outputs.output[output_indx].next_nodes_port = input_indx;
-			nodes[next_node_id].inputs.input[input_indx].prev_nodes_id = current_node_id;
+	if ( current_node_id != COMPONENT_NOT_FOUND && next_node_id != COMPONENT_NOT_FOUND && output_indx >= 0 && input_indx >= 0 )
+	{
+
+		nodes[current_node_id].outputs.output[output_indx].next_nodes_id = next_node_id;
+		nodes[current_node_id].outputs.output[output_indx].next_nodes_port = input_indx;
+		nodes[next_node_id].inputs.input[input_indx].prev_nodes_id = current_node_id;
 
+	}
+	else
+	{
+		cout << "Netlist Error" << endl;
+
+		if ( current_node_id == COMPONENT_NOT_FOUND )
+		{
+			cout << "Node Description "<< src_name << " not found. Not ID assigned" << endl;
+		}
+		else if ( next_node_id == COMPONENT_NOT_FOUND )
+		{
+			cout << "Node ID" << current_node_id << "Node Name: " << nodes[current_node_id].name << " has not next node for output " << output_indx << endl;
 		}
 		else
 		{
-			cout << "Netlist Error" << endl;
-
-			if ( current_node_id == COMPONENT_NOT_FOUND )
-			{
-				cout << "Node Description "<< v[0] << " not found. Not ID assigned" << endl;
-			}
-			else
-
-				if ( next_node_id == COMPONENT_NOT_FOUND )
-				{
-					cout << "Node ID" << current_node_id << "Node Name: " << nodes[current_node_id].name << " has not next node for output " << output_indx << endl;
-				}
-
-			cout << "Exiting without producing netlist" << endl;
-			exit ( 0);
-
+			cout << "Edge " << src_name << " -> " << dst_name << " has no from/to ports" << endl;
 		}
 
+		cout << "Exiting without producing netlist" << endl;
+		exit ( 0);
+
 	}
 }
 
@@ -672,8 +720,13 @@ void parse_components ( string v_0, string v_1 )
 	vector<string> parameters;
 	string parameter;
 
+	nodes.emplace_back(); // Value-initialized: all the fields without default are zero
 	nodes[components_in_netlist].name = get_component_name ( v_0 );
-	if ( !( nodes[components_in_netlist].name.empty() ) ) //Check if the name is not empty
+	if ( nodes[components_in_netlist].name.empty() ) //Check if the name is not empty
+	{
+		nodes.pop_back();
+	}
+	else
 	{
 
 		string_split( v_1, ',', parameters );
@@ -951,11 +1004,8 @@ void parse_components ( string v_0, string v_1 )
 
 
 
+		node_ids.emplace( nodes[components_in_netlist].name, components_in_netlist ); // The first component with a name is kept
 		components_in_netlist++;
-		if ( components_in_netlist >= MAX_NODES )
-		{
-			cout << "The number of components in the netlist exceed the maximum allowed "<< MAX_NODES << endl;
-		}
 
 	}
 }
@@ -984,23 +1034,119 @@ void parse_line ( string line )
 
 
 
-void parse_dot ( string filename )
+void parse_dot ( istream& in )
 {
-
-	string input_filename = filename + ".dot";
-	ifstream inFile(input_filename);
 	string strline;
 
 	components_in_netlist = 0;
+	nodes.clear();
+	node_ids.clear();
 
-	if (inFile.is_open())
+	while ( in )
+	{
+		getline(in, strline );
+		parse_line ( strline );
+	}
+}
+
+// Reads a binary netlist (see NetlistBinary.h). The attributes of every node are
+// parsed as in its line of the dot file, and the edges are connected directly
+// with their from/to attributes.
+void parse_dfb ( const string& input_filename )
+{
+	NetlistBinary::Reader reader;
+
+	if ( !reader.open( input_filename ) )
+	{
+		cout << reader.getError() << endl << endl << endl;
+		exit ( EXIT_FAILURE );
+	}
+
+	components_in_netlist = 0;
+	nodes.clear();
+	node_ids.clear();
+
+	// The type goes first, as in the dot files (the other attributes may refine it)
+	vector<int> node_columns;
+	for ( int col = 0; col < reader.numColumns(); col++ )
+	{
+		if ( reader.column( col ).owner == NetlistBinary::NODE )
+		{
+			if ( string( reader.columnKey( col ) ) == "type" )
+			{
+				node_columns.insert( node_columns.begin(), col );
+			}
+			else
+			{
+				node_columns.push_back( col );
+			}
+		}
+	}
+
+	for ( int indx = 0; indx < reader.numNodes(); indx++ )
+	{
+		string name = reader.nodeName( indx );
+		string attributes;
+		for ( int col : node_columns )
+		{
+			if ( reader.has( col, indx ) )
+			{
+				attributes += ( attributes.empty() ? "" : ", " ) + string( reader.columnKey( col ) ) + "=\"" + reader.getText( col, indx ) + "\"";
+			}
+		}
+
+		// Only the nodes with a type are components (see check_line)
+		if ( name.find("type") != std::string::npos || attributes.find("type") != std::string::npos )
+		{
+			parse_components ( name, attributes + "]" );
+		}
+	}
+
+	int from_col = reader.findColumn( NetlistBinary::EDGE, "from" );
+	int to_col = reader.findColumn( NetlistBinary::EDGE, "to" );
+
+	for ( int indx = 0; indx < reader.numEdges(); indx++ )
 	{
-		while ( inFile )
+		int output_indx = COMPONENT_NOT_FOUND;
+		int input_indx = COMPONENT_NOT_FOUND;
+		if ( from_col >= 0 && reader.has( from_col, indx ) )
 		{
-			getline(inFile, strline );
-			parse_line ( strline );
+			output_indx = get_edge_port( reader.getText( from_col, indx ) ) - 1;
 		}
+		if ( to_col >= 0 && reader.has( to_col, indx ) )
+		{
+			input_indx = get_edge_port( reader.getText( to_col, indx ) ) - 1;
+		}
+
+		string src_name = reader.nodeName( reader.edgeSrc( indx ) );
+		string dst_name = reader.nodeName( reader.edgeDst( indx ) );
+		connect_nodes( get_edge_node_name( src_name, 0, src_name.size() ), get_edge_node_name( dst_name, 0, dst_name.size() ), output_indx, input_indx );
+	}
+}
+
+// Returns true if filename names a binary netlist
+bool is_binary_netlist ( const string& filename )
+{
+	string extension = NetlistBinary::EXTENSION;
+	return filename.size() > extension.size() &&
+		   filename.compare( filename.size() - extension.size(), extension.size(), extension ) == 0;
+}
 
+void parse_dot ( string filename )
+{
+	if ( is_binary_netlist ( filename ) )
+	{
+		parse_dfb ( filename );
+		return;
+	}
+
+	string input_filename = filename + ".dot";
+
+	ifstream inFile(input_filename);
+
+	if (inFile.is_open())
+	{
+		parse_dot ( inFile );
 		inFile.close();
 	}
 	else
@@ -1011,3 +1157,29 @@ void parse_dot ( string filename )
 }
 
 
+
+void benchmark_parse_dot ( int edges )
+{
+	// Synthetic netlist: every node has two inputs and two outputs
+	int nodes_count = max( 1, edges / 2 );
+	stringstream dot;
+
+	dot << "Digraph G {" << endl;
+	for ( int indx = 0; indx < nodes_count; indx++ )
+	{
+		dot << "\t\t\"add_" << indx << "\" [type = \"Operator\", bbID= 1, op = \"add_op\", in = \"in1:32 in2:32 \", out = \"out1:32 out2:32 \", delay=1.693];" << endl;
+	}
+	for ( int indx = 0; indx < nodes_count; indx++ )
+	{
+		dot << "\t\t\"add_" << indx << "\" -> \"add_" << ( indx + 1 ) % nodes_count << "\" [color = \"red\", from = \"out1\", to = \"in1\"];" << endl;
+		dot << "\t\t\"add_" << indx << "\" -> \"add_" << ( indx + nodes_count - 1 ) % nodes_count << "\" [color = \"red\", from = \"out2\", to = \"in2\"];" << endl;
+	}
+	dot << "}" << endl;
+
+	auto start = chrono::steady_clock::now();
+	parse_dot ( dot );
+	auto end = chrono::steady_clock::now();
+
+	cout << "Parsed " << components_in_netlist << " components and " << 2 * nodes_count << " edges in "
+		 << chrono::duration_cast<chrono::milliseconds>( end - start ).count() << " ms" << endl;
+}
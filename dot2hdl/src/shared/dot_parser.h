@@ -13,17 +13,52 @@
 #ifndef _DOT_PARSER_
 #define _DOT_PARSER_
 
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 using namespace std;
 
 #define COMMENT_CHARACTER '/'
 
 
-#define MAX_INPUTS  512//64
-#define MAX_OUTPUTS 512// 64
-
 #define COMPONENT_NOT_FOUND -1 
 
+// Ports of a node. The vector grows on demand when a port is accessed,
+// so that each node only stores the ports it actually has and the ports
+// can be filled in any order while parsing.
+template <typename T>
+struct port_vector
+{
+    vector<T> ports;
+
+    T& operator[] ( int indx )
+    {
+        if ( indx >= (int)ports.size() )
+        {
+            ports.resize( indx + 1 );
+        }
+        return ports[indx];
+    }
+
+    // Non-growing access for the passes that write several nodes in parallel:
+    // ports beyond the parsed ones read as default ports.
+    const T& get ( int indx ) const
+    {
+        static const T unset;
+        return ( indx >= 0 && indx < (int)ports.size() ) ? ports[indx] : unset;
+    }
+
+    void fit ( int size )
+    {
+        if ( size > (int)ports.size() )
+        {
+            ports.resize( size );
+        }
+    }
+};
+
 typedef struct input
 {
     int bit_size = 32;
@@ -36,7 +71,7 @@ typedef struct input
 typedef struct in
 {
     int size = 0;
-    INPUT_T input[MAX_OUTPUTS];
+    port_vector<INPUT_T> input;
 } IN_T;
 
 typedef struct output
@@ -53,7 +88,7 @@ typedef struct output
 typedef struct out
 {
     int size = 0;
-    OUTPUT_T output[MAX_OUTPUTS];
+    port_vector<OUTPUT_T> output;
 } OUT_T;
 
 
@@ -101,11 +136,21 @@ typedef struct node
 void printNode(NODE_T nodes);
 
 
-#define MAX_NODES 16384//4096
-
+// Reads the binary netlist filename if it ends with .dfb, and <filename>.dot otherwise
 void parse_dot ( string filename );
+bool is_binary_netlist ( const string& filename );
+void parse_dot ( istream& in );
+void parse_dfb ( const string& input_filename );
+
+void connect_nodes ( const string& src_name, const string& dst_name, int output_indx, int input_indx );
+
+// Parses a synthetic netlist with the given number of edges and reports the time
+void benchmark_parse_dot ( int edges );
+
+int find_node ( const string& name );
 
-extern NODE_T nodes[MAX_NODES];
+extern vector<NODE_T> nodes;
+extern unordered_map<string, int> node_ids;
 
 extern int components_in_netlist;
 extern int lsqs_in_netlist;
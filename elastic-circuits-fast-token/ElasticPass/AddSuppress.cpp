@@ -59,62 +59,40 @@ void CircuitGenerator::identifyBBsForwardControlDependency() {
 	 * 1) there exists a directed path from bbnode_dag->at(j) to bbnode_dag->at(i) with all nodes in the path (excluding i and j) post-dominated by bbnode_dag->at(i)
 	 * AND
 	 * 2) bbnode_dag->at(j) is not post-dominated by bbnode_dag->at(i)
+	 *
+	 * i.e., bbnode_dag->at(j) is in the post-dominance frontier of bbnode_dag->at(i). Instead of enumerating the paths between all pairs of BBs,
+	 * for every CFG edge (j -> succ) we walk up the post-dominator tree from succ until the immediate post-dominator of j:
+	 * all the BBs visited post-dominate succ but not j, so they are control dependent on j. This is linear in the size of the CFG and the control dependencies.
+	 * Only the forward dependencies (j before i in the CFG) are kept.
 	 */
-	for(int i = bbnode_dag->size()-1; i > 0; i--) {
-		dbg_file_verbose << "\n****************************************\n";
-		dbg_file_verbose << "\nCurrently studying the control dependencies of BB" << bbnode_dag->at(i)->Idx + 1 << "\n";
-		// for every bbnode, check for forward control dependencies in all BBs before it in the CFG
-		for(int j = 0; j < i; j++) {
-			assert(bbnode_dag->at(i)->BB != bbnode_dag->at(j)->BB);
-			// if bbnode is post-dominated by BB, then for sure BB is not control dependent on bbnode
-			if(my_post_dom_tree->properlyDominates(bbnode_dag->at(i)->BB, bbnode_dag->at(j)->BB)) {
-				dbg_file_verbose << "BB" << bbnode_dag->at(i)->Idx + 1 << " is not control dependent on BB" << bbnode_dag->at(j)->Idx + 1 << "!!\n";
-				continue;  // no need to do anything!
-			} else {
-				// BB doesn't post-dominate bbnode, so check condition 1) for control dependence by enumerating paths
-				assert(!my_post_dom_tree->properlyDominates(bbnode_dag->at(i)->BB, bbnode_dag->at(j)->BB));
-				int cfg_size = bbnode_dag->size();
-				bool *visited = new bool[cfg_size];
-				int *path = new int[cfg_size];
-				int path_index = 0; 
-				std::vector<std::vector<int>>* final_paths = new std::vector<std::vector<int>>;
-				enumerateBBpaths_dfs(bbnode_dag->at(i), bbnode_dag->at(j), visited, path, 0, final_paths, false);
-				if(final_paths->size() == 0) {
-					dbg_file_verbose << "BB" << bbnode_dag->at(i)->Idx + 1 << " is not reachable from BB" << bbnode_dag->at(j)->Idx + 1 << "!!\n";
-					continue;
-				} else {
-					bool is_dep = true;
-
-					///////////// Debugging ///////////////
-					dbg_file_verbose << "\nThere are " << final_paths->size() << " paths between BB" << bbnode_dag->at(i)->Idx + 1 << " and BB" << bbnode_dag->at(j)->Idx + 1 << "\n";
-					for(int kk = 0; kk < final_paths->size(); kk++) {
-						dbg_file_verbose << "\nThe size of path " << kk << " is " << final_paths->at(kk).size() << "\n";
-						dbg_file_verbose << "\tOne path is composed of: ";
-						for(int hh = 0; hh < final_paths->at(kk).size(); hh++) {
-							dbg_file_verbose << "BB" << bbnode_dag->at(final_paths->at(kk).at(hh))->Idx + 1 << ", ";
-						} 
-						dbg_file_verbose << "\n";
-					} 
-					///////////////////////////////////////
-
-					// loop over all BBs in all of the enumerated paths
-					for(int kk = 0; kk < final_paths->size(); kk++) {
-						for(int hh = 0; hh < final_paths->at(kk).size(); hh++) {
-							if(bbnode_dag->at(final_paths->at(kk).at(hh)) != bbnode_dag->at(i) && bbnode_dag->at(final_paths->at(kk).at(hh)) != bbnode_dag->at(j) && !my_post_dom_tree->properlyDominates(bbnode_dag->at(i)->BB, bbnode_dag->at(final_paths->at(kk).at(hh))->BB )) {
-								is_dep = false;
-								break;
-							}
-						} 
-					}
-
-					if(is_dep) { // BB is control dependent on bbnode
-						dbg_file_verbose << "\n\tBB" << bbnode_dag->at(i)->Idx + 1 << " is control dependent on BB" << bbnode_dag->at(j)->Idx + 1 << "!!\n";
-						bbnode_dag->at(i)->BB_deps->push_back(bbnode_dag->at(j)->Idx);
-					} 
+	std::vector<std::set<int>> forward_deps(bbnode_dag->size());
+	for(int j = 0; j < bbnode_dag->size(); j++) {
+		BBNode* bbnode = bbnode_dag->at(j);
+		DomTreeNodeBase<BasicBlock>* bb_pdom_node = my_post_dom_tree->getNode(bbnode->BB);
+		if(bb_pdom_node == nullptr)
+			continue;  // the BB does not reach the exit of the function
+		DomTreeNodeBase<BasicBlock>* bb_ipdom = bb_pdom_node->getIDom();
+
+		for(auto& bb_succ : *bbnode->CntrlSuccs) {
+			DomTreeNodeBase<BasicBlock>* runner = my_post_dom_tree->getNode(bb_succ->BB);
+			// the root of the tree has no BB when the function has several exits
+			while(runner != nullptr && runner != bb_ipdom && runner->getBlock() != nullptr) {
+				int i = BBMap->at(runner->getBlock())->Idx;
+				if(j < i) {
+					forward_deps.at(i).insert(j);
 				}
-				delete final_paths;
+				runner = runner->getIDom();
 			}
+		}
+	}
 
+	for(int i = bbnode_dag->size()-1; i > 0; i--) {
+		dbg_file_verbose << "\n****************************************\n";
+		dbg_file_verbose << "\nCurrently studying the control dependencies of BB" << bbnode_dag->at(i)->Idx + 1 << "\n";
+		// the set is sorted, so the dependencies are pushed in the order of the CFG
+		for(int j : forward_deps.at(i)) {
+			dbg_file_verbose << "\n\tBB" << bbnode_dag->at(i)->Idx + 1 << " is control dependent on BB" << bbnode_dag->at(j)->Idx + 1 << "!!\n";
+			bbnode_dag->at(i)->BB_deps->push_back(bbnode_dag->at(j)->Idx);
 		}
 	}
 
@@ -915,8 +893,30 @@ void CircuitGenerator::addSuppress_with_loops(networkType network_flag) {
 				// run Shannon's expansion on f_supp to correctly calculate the condition
 				bool is_negated_cond;
 
-				dbg_file_5 << "\n\tRight before calling applyShannon, the size of f_supp is: " << f_supp.size() << "\n";
-				ENode* supp_condition_enode = applyShannon(dbg_file_6, dbg_file_5, producer->BB, f_supp, is_negated_cond);
+				ENode* supp_condition_enode = nullptr;
+				if(f_supp.size() == 1 && f_supp.at(0).size() == 0) {
+					// f_supp = 1: the token is never consumed, so it is always suppressed.
+						// applyShannon expects products of BB conditions, so the condition of the Branch is a constant 1 triggered by a SOURCE
+						// (the consumer keeps its input from the false side of the Branch, which never fires)
+					dbg_file_5 << "\n\tF_SUPP is the constant 1, the Branch condition is a constant!!\n";
+					supp_condition_enode = new ENode(Cst_, std::to_string(1).c_str(), producer->BB);
+					supp_condition_enode->cstValue = 1;
+					enode_dag->push_back(supp_condition_enode);
+					supp_condition_enode->id = cst_id++;
+
+					supp_condition_enode->is_const_for_cond = true;
+
+					ENode* source_node = new ENode(Source_, "source", supp_condition_enode->BB);
+					source_node->id    = source_id++;
+					supp_condition_enode->JustCntrlPreds->push_back(source_node);
+					source_node->JustCntrlSuccs->push_back(supp_condition_enode);
+					enode_dag->push_back(source_node);
+
+					is_negated_cond = false;
+				} else {
+					dbg_file_5 << "\n\tRight before calling applyShannon, the size of f_supp is: " << f_supp.size() << "\n";
+					supp_condition_enode = applyShannon(dbg_file_6, dbg_file_5, producer->BB, f_supp, is_negated_cond);
+				}
 
 				insertBranch(network_flag, supp_condition_enode, producer, consumer, is_negated_cond);
 			
@@ -1456,36 +1456,65 @@ bool CircuitGenerator::calculate_F_Supp(std::ofstream& dbg_file, const std::vect
 	dbg_file << "\n\n";
 	/////////////////////////////////
 
-	// 2) if the token is guaranteed to be produced, we only need to SUPPRESS at the negation of f_cons
-	if(f_prod.size() == 0) {
-		std::vector<std::vector<pierCondition>> f_supp;
-		NegateApplydeMorgans(dbg_file, f_cons, f_supp);
-		Simplify_Quine_McCluskey(dbg_file, f_supp, f_supp_simplified, false);
-		return true;
+	// f_supp = f_prod AND NOT(f_cons), where an empty f_prod means that the token is guaranteed to be produced.
+		// The functions are combined as BDDs, which avoids expanding the negation of f_cons with deMorgan's (exponential in the number of products)
+	BDD_Manager bdd;
+	BDD_Manager::Node prod = (f_prod.size() == 0)? BDD_Manager::ONE : SOP_to_BDD(bdd, f_prod);
+	BDD_Manager::Node supp = bdd.AND(prod, bdd.NOT(SOP_to_BDD(bdd, f_cons)));
+
+	// 2) if the token is consumed whenever it is produced, we don't need a SUPPRESS
+	if(supp == BDD_Manager::ZERO) {
+		dbg_file << "\n\nf_supp = 0, no SUPPRESS is needed\n\n";
+		return false;
 	}
 
-	// the normal case f_supp = f_prod AND NOT(f_cons)
-	std::vector<std::vector<pierCondition>> negated_f_cons;
-	NegateApplydeMorgans(dbg_file, f_cons, negated_f_cons);
-	// AND f_prod with the negated_f_cons
-	std::vector<std::vector<pierCondition>> f_supp;
-	std::vector<pierCondition> one_merged_product;
-	for(int i = 0; i < f_prod.size(); i++) {
-		for(int j = 0; j < negated_f_cons.size(); j++) {
-			one_merged_product.clear();
-			one_merged_product.reserve(f_prod.at(i).size() + negated_f_cons.at(j).size());
-			one_merged_product.insert(one_merged_product.end(), f_prod.at(i).begin(), f_prod.at(i).end());
-			one_merged_product.insert(one_merged_product.end(), negated_f_cons.at(j).begin(), negated_f_cons.at(j).end());
-			f_supp.push_back(one_merged_product);
-		}
+	// 3) the token is never consumed, so it is always suppressed
+		// f_supp = 1 is returned as a single empty product, which the caller implements with a constant condition
+	if(supp == BDD_Manager::ONE) {
+		dbg_file << "\n\nf_supp = 1, the token is always suppressed\n\n";
+		f_supp_simplified.push_back(std::vector<pierCondition>());
+		return true;
 	}
 
-	// simplify f_supp where possible using Quine McCluskey
+	// simplify f_supp where possible using Quine McCluskey, starting from the irredundant cover of the BDD
+	std::vector<std::vector<pierCondition>> f_supp;
+	BDD_to_SOP(bdd, supp, f_supp);
 	Simplify_Quine_McCluskey(dbg_file, f_supp, f_supp_simplified, false);
 
 	return true; 
 }
 
+/**
+ * @brief Builds the BDD of a sum of products of BB conditions.
+ * @param f The sum of products. An empty sum is the constant 0.
+ */
+BDD_Manager::Node CircuitGenerator::SOP_to_BDD(BDD_Manager& bdd, const std::vector<std::vector<pierCondition>>& f) {
+	std::vector<BDD_Manager::Product> sop(f.size());
+	for(int i = 0; i < f.size(); i++) {
+		for(int j = 0; j < f.at(i).size(); j++) {
+			sop.at(i).push_back(BDD_Manager::Literal(f.at(i).at(j).pierBB_index, f.at(i).at(j).is_negated));
+		}
+	}
+	return bdd.fromSOP(sop);
+}
+
+/**
+ * @brief Fills f_sop with an irredundant sum of products of the BDD f.
+ */
+void CircuitGenerator::BDD_to_SOP(BDD_Manager& bdd, BDD_Manager::Node f, std::vector<std::vector<pierCondition>>& f_sop) {
+	std::vector<BDD_Manager::Product> sop = bdd.toSOP(f);
+	for(int i = 0; i < sop.size(); i++) {
+		std::vector<pierCondition> one_product;
+		for(int j = 0; j < sop.at(i).size(); j++) {
+			pierCondition cond;
+			cond.pierBB_index = sop.at(i).at(j).first;
+			cond.is_negated = sop.at(i).at(j).second;
+			one_product.push_back(cond);
+		}
+		f_sop.push_back(one_product);
+	}
+}
+
 
 /**
  * @brief  
@@ -0,0 +1,136 @@
+#include "ElasticPass/BDD.h"
+
+#include <algorithm>
+#include <climits>
+
+const BDD_Manager::Node BDD_Manager::ZERO;
+const BDD_Manager::Node BDD_Manager::ONE;
+const int BDD_Manager::TERMINAL_VAR = INT_MAX;
+
+BDD_Manager::BDD_Manager() {
+	// the two terminals are always the first nodes
+	NodeData zero = {TERMINAL_VAR, ZERO, ZERO};
+	NodeData one = {TERMINAL_VAR, ONE, ONE};
+	nodes.push_back(zero);
+	nodes.push_back(one);
+}
+
+BDD_Manager::Node BDD_Manager::mk(int var_index, Node low, Node high) {
+	// reduction rule: a node with two equal cofactors is redundant
+	if(low == high)
+		return low;
+
+	std::tuple<int, Node, Node> key(var_index, low, high);
+	auto pos = unique_table.find(key);
+	if(pos != unique_table.end())
+		return pos->second;
+
+	NodeData data = {var_index, low, high};
+	Node node = nodes.size();
+	nodes.push_back(data);
+	unique_table[key] = node;
+	return node;
+}
+
+BDD_Manager::Node BDD_Manager::cofactor(Node f, int var_index, bool value) const {
+	// f does not depend on variables above its top variable
+	if(nodes[f].var != var_index)
+		return f;
+	return value ? nodes[f].high : nodes[f].low;
+}
+
+BDD_Manager::Node BDD_Manager::var(int var_index) {
+	return mk(var_index, ZERO, ONE);
+}
+
+BDD_Manager::Node BDD_Manager::literal(int var_index, bool is_negated) {
+	return is_negated ? mk(var_index, ONE, ZERO) : mk(var_index, ZERO, ONE);
+}
+
+BDD_Manager::Node BDD_Manager::ite(Node f, Node g, Node h) {
+	// terminal cases
+	if(f == ONE)
+		return g;
+	if(f == ZERO)
+		return h;
+	if(g == h)
+		return g;
+	if(g == ONE && h == ZERO)
+		return f;
+
+	std::tuple<Node, Node, Node> key(f, g, h);
+	auto pos = ite_cache.find(key);
+	if(pos != ite_cache.end())
+		return pos->second;
+
+	int top = std::min(nodes[f].var, std::min(nodes[g].var, nodes[h].var));
+	Node low = ite(cofactor(f, top, false), cofactor(g, top, false), cofactor(h, top, false));
+	Node high = ite(cofactor(f, top, true), cofactor(g, top, true), cofactor(h, top, true));
+	Node result = mk(top, low, high);
+
+	ite_cache[key] = result;
+	return result;
+}
+
+BDD_Manager::Node BDD_Manager::NOT(Node f) {
+	return ite(f, ZERO, ONE);
+}
+
+BDD_Manager::Node BDD_Manager::AND(Node f, Node g) {
+	return ite(f, g, ZERO);
+}
+
+BDD_Manager::Node BDD_Manager::OR(Node f, Node g) {
+	return ite(f, ONE, g);
+}
+
+BDD_Manager::Node BDD_Manager::fromSOP(const std::vector<Product>& sop) {
+	Node f = ZERO;
+	for(int i = 0; i < sop.size(); i++) {
+		Node product = ONE;
+		for(int j = 0; j < sop.at(i).size(); j++) {
+			product = AND(product, literal(sop.at(i).at(j).first, sop.at(i).at(j).second));
+		}
+		f = OR(f, product);
+	}
+	return f;
+}
+
+std::vector<BDD_Manager::Product> BDD_Manager::toSOP(Node f) {
+	std::vector<Product> cover;
+	Product cube;
+	isop(f, f, cube, cover);
+	return cover;
+}
+
+/**
+ * @brief Minato-Morreale irredundant sum of products of any function between lower and upper.
+ * @param cube The literals of the variables above lower and upper (the current path).
+ * @param cover The products of the result are appended to it.
+ * @return The BDD of the cover.
+ */
+BDD_Manager::Node BDD_Manager::isop(Node lower, Node upper, Product& cube, std::vector<Product>& cover) {
+	if(lower == ZERO)
+		return ZERO;
+	if(upper == ONE) {
+		cover.push_back(cube);
+		return ONE;
+	}
+
+	int top = std::min(nodes[lower].var, nodes[upper].var);
+	Node lower_0 = cofactor(lower, top, false), lower_1 = cofactor(lower, top, true);
+	Node upper_0 = cofactor(upper, top, false), upper_1 = cofactor(upper, top, true);
+
+	// the products that need the negated variable, then those that need the variable
+	cube.push_back(Literal(top, true));
+	Node cover_0 = isop(AND(lower_0, NOT(upper_1)), upper_0, cube, cover);
+	cube.back().second = false;
+	Node cover_1 = isop(AND(lower_1, NOT(upper_0)), upper_1, cube, cover);
+	cube.pop_back();
+
+	// the rest of the function is covered by products without the variable
+	Node lower_rest = OR(AND(lower_0, NOT(cover_0)), AND(lower_1, NOT(cover_1)));
+	Node cover_rest = isop(lower_rest, AND(upper_0, upper_1), cube, cover);
+
+	return OR(mk(top, cover_0, cover_1), cover_rest);
+}
@@ -1,5 +1,8 @@
 #include "ElasticPass/Quine_McCluskey.h"
 
+#include <algorithm>
+#include <cassert>
+
 
 void Quine_McCluskey::initialize(int number_of_bits, int number_of_minterms, int number_of_dont_cares, vector<string>* minterms_only_in_binary, vector<string>* minterms_dont_cares_in_binary) {
 
@@ -7,32 +10,87 @@ void Quine_McCluskey::initialize(int number_of_bits, int number_of_minterms, int
 	nMin = number_of_minterms;
 	nDontCares = number_of_dont_cares;
 	nMinPlusDontCares = nMin + nDontCares;
-	
+
+	assert(nBits <= 64);
+
+	// the repeated minterms are only kept once
+	unordered_set<Implicant, ImplicantHash> seen;
 	for (int i = 0; i < nMin; ++i){
-		minOnlyBin.push_back(minterms_only_in_binary->at(i));
+		Implicant imp = toImplicant(minterms_only_in_binary->at(i));
+		if (seen.insert(imp).second)
+			minOnly.push_back(imp);
 	}
 
+	seen.clear();
 	for (int i = 0; i < nMinPlusDontCares; ++i){
-		minPlusDontCaresBin.push_back(minterms_dont_cares_in_binary->at(i));
+		Implicant imp = toImplicant(minterms_dont_cares_in_binary->at(i));
+		if (seen.insert(imp).second)
+			minPlusDontCares.push_back(imp);
+	}
+
+	// initializing the table of prime implicants
+	table = vector< vector< Implicant> >(nBits+1);
+
+}
+
+Quine_McCluskey::Implicant Quine_McCluskey::toImplicant(const string& bin) const {
+	Implicant imp = {0, 0};
+	for (int i = 0; i < bin.size(); ++i){
+		if (bin[i] == '1')
+			imp.value |= uint64_t(1) << i;
+		else if (bin[i] == '-')
+			imp.mask |= uint64_t(1) << i;
 	}
+	return imp;
+}
 
-	// initializing the table of prime implicants 
-	table = vector< vector< string> >(nBits+1);
+string Quine_McCluskey::toString(const Implicant& imp) const {
+	string bin(nBits, '0');
+	for (int i = 0; i < nBits; ++i){
+		if ((imp.mask >> i) & 1)
+			bin[i] = '-';
+		else if ((imp.value >> i) & 1)
+			bin[i] = '1';
+	}
+	return bin;
+}
 
+void Quine_McCluskey::printTable(std::ofstream& dbg_file, std::string title) {
+	dbg_file << "\n" << title << "\n";
+	for (int i = 0; i < table.size(); ++i){
+		dbg_file << i << ")  ";
+		for (int j = 0; j < table[i].size(); ++j){
+			dbg_file << toString(table[i][j]) << ", ";
+		}
+		dbg_file << endl;
+	}
+	dbg_file << "\n";
 }
 
-vector< vector< string> > Quine_McCluskey::combinePairs(vector< vector< string> > table, set<string>& primeImpTemp) {
-	bool checked[table.size()][nMinPlusDontCares] = {false};
-	vector< vector< string> > newTable(table.size()-1);
+void Quine_McCluskey::combinePairs(vector<string>& primeImpTemp) {
+	// two implicants can only be combined if they are in consecutive buckets, have the same mask
+	// and their values differ in one bit; the combined implicants are deduplicated with a hash set
+	vector< vector< Implicant> > newTable(table.size()-1);
+	vector< unordered_set<Implicant, ImplicantHash> > newSeen(table.size()-1);
+	vector< vector<bool> > checked(table.size());
+	for (int i = 0; i < table.size(); ++i){
+		checked[i].assign(table[i].size(), false);
+	}
 
 	for (int i = 0; i < table.size() -1; ++i){
 		for (int j = 0; j < table[i].size(); ++j){
+			const Implicant& a = table[i][j];
 			for (int k = 0; k < table[i+1].size(); k++){
-				if (util.compare(table[i][j], table[i+1][k])){
-					newTable[i].push_back(util.getDiff(table[i][j], table[i+1][k]));
-					checked[i][j] = true;
-					checked[i+1][k] = true;
-				}
+				const Implicant& b = table[i+1][k];
+				uint64_t diff = a.value ^ b.value;
+				if (a.mask != b.mask || (diff & (diff - 1)) != 0)
+					continue;
+
+				Implicant combined = {a.value & ~diff, a.mask | diff};
+				if (newSeen[i].insert(combined).second)
+					newTable[i].push_back(combined);
+				checked[i][j] = true;
+				checked[i+1][k] = true;
 			}
 		}
 	}
@@ -40,182 +98,141 @@ vector< vector< string> > Quine_McCluskey::combinePairs(vector< vector< string>
 	for (int i = 0; i < table.size(); ++i){
 		for (int j = 0; j < table[i].size(); ++j){
 			if (!checked[i][j]) {
-				primeImpTemp.insert(table[i][j]);
+				primeImpTemp.push_back(toString(table[i][j]));
 			}
 		}
 	}
 
-	return newTable;
+	table.swap(newTable);
 }
 
 
 void Quine_McCluskey::createTable(std::ofstream& dbg_file, bool print_flag) {
-	for (int i = 0; i < nMinPlusDontCares; ++i){
-		int num1s = util.get1s(minPlusDontCaresBin[i]);
-		table[num1s].push_back(minPlusDontCaresBin[i]);
+	for (int i = 0; i < minPlusDontCares.size(); ++i){
+		int num1s = __builtin_popcountll(minPlusDontCares[i].value);
+		table[num1s].push_back(minPlusDontCares[i]);
 	}
 
 	if(print_flag) {
-		dbg_file << "\nPrinting the prime implicants table in its first state:\n";
-		for (int i = 0; i < nBits+1; ++i){
-			dbg_file << i << ")  ";
-			for (int j = 0; j < table[i].size(); ++j){
-				dbg_file << table[i][j] << ", ";
-			}
-			dbg_file << endl;
-		}	
-		dbg_file << "\n";
+		printTable(dbg_file, "Printing the prime implicants table in its first state:");
 	}
-	
+
 }
 
 void Quine_McCluskey::setPrimeImp(std::ofstream& dbg_file, bool print_flag) {
-	set<string> primeImpTemp;
+	vector<string> primeImpTemp;
 	createTable(dbg_file, print_flag);
-	// cout << "\nGetting Prime Implicants.." << endl;
 
 	// Combine consecutive terms in the table until its empty
-	while (!util.checkEmpty(table)){
-		table = combinePairs(table, primeImpTemp);
-	}
-	
-	set<string > :: iterator itr;  // convert set to vector
-	 for (itr = primeImpTemp.begin(); itr != primeImpTemp.end(); ++itr){
-	 	string x = *itr;
-    	primeImp.push_back(x);
+	while (!table.empty()){
+		combinePairs(primeImpTemp);
 	}
 
+	// the prime implicants are sorted as strings
+	sort(primeImpTemp.begin(), primeImpTemp.end());
+	primeImpTemp.erase(unique(primeImpTemp.begin(), primeImpTemp.end()), primeImpTemp.end());
+	primeImp = primeImpTemp;
+
 	if(print_flag) {
 		dbg_file << "\nPrinting the combined prime implicants:\n";
 		for (int i = 0; i < primeImp.size(); ++i){
 			dbg_file << i << ")  " << primeImp[i];
 			dbg_file << endl;
-		}	
+		}
 		dbg_file << "\n";
 	}
-	
-
-	/*cout << "\nThe Prime Implicants are:" << endl;
-	for (int i = 0; i < primeImp.size(); ++i){
-		cout  << i << ") "<< util.binToString(primeImp[i]) << endl;
-	}*/
-}
-
-void Quine_McCluskey::getPosComb(vector< set<int> > &patLogic, int level, set<int> prod, set< set<int> > &posComb) {
-	// a recursive function to multiple elements of set patLogic and store it in set posComb
-	if (level == patLogic.size()){
-		set<int> x = prod;
-		posComb.insert(x);
-		return;
-	}
-	else{
-		set<int > :: iterator itr;  
-		for (itr = patLogic[level].begin(); itr != patLogic[level].end(); ++itr){
-
-			int x = *itr;
-        	bool inserted = prod.insert(x).second;
-        	getPosComb(patLogic, level+1, prod, posComb);
-        	if (inserted){
-        		prod.erase(x);
-        	}
-    	}
-	}
 }
 
 void Quine_McCluskey::minimize(std::ofstream& dbg_file, bool print_flag) {
-	// prepare the primeImp chart to identify the essential prime implicants
-	// NOte the number of columns of this chart is only nMin not nMinPlusDontCares!!
-	bool primeImpChart[primeImp.size()][nMin] = {{false}};
-
-	for (int i = 0; i < primeImp.size(); ++i){
-		for (int j = 0; j < nMin; ++j){
-			primeImpChart[i][j] = util.primeIncludes(primeImp[i], minOnlyBin[j]);
+	// prepare the primeImp chart: one bitset per prime implicant with the minterms it covers
+	// NOte the number of columns of this chart is only the minterms not the don't-cares!!
+	int nWords = (minOnly.size() + 63) / 64;
+	int nPrimes = primeImp.size();
+	vector< vector<uint64_t> > primeImpChart(nPrimes, vector<uint64_t>(nWords, 0));
+	vector<int> numLiterals(nPrimes);
+
+	for (int i = 0; i < nPrimes; ++i){
+		Implicant imp = toImplicant(primeImp[i]);
+		numLiterals[i] = nBits - __builtin_popcountll(imp.mask);
+		for (int j = 0; j < minOnly.size(); ++j){
+			if (((minOnly[j].value ^ imp.value) & ~imp.mask) == 0)
+				primeImpChart[i][j / 64] |= uint64_t(1) << (j % 64);
 		}
 	}
 
 	if(print_flag) {
 		dbg_file << "\nPrinting the prime implicant chart\n";
 		// loop over the rows (each row is a combined prime implicant)
-		for (int i = 0; i < primeImp.size(); ++i){
-			for (int j = 0; j < nMin; ++j){
-				if (primeImpChart[i][j] == true){
-		 			dbg_file << "1\t";
-		 		}
-		 		else {
-		 			dbg_file << "0\t";
-		 		}
+		for (int i = 0; i < nPrimes; ++i){
+			for (int j = 0; j < minOnly.size(); ++j){
+				dbg_file << ((primeImpChart[i][j / 64] >> (j % 64)) & 1) << "\t";
 			}
 			dbg_file << "\n";
 		}
 	}
-	
-	// petric logic
-	vector< set<int> > patLogic;
-	for (int j = 0; j < nMin; ++j){ // column iteration
-		set<int> x;
-		for (int i = 0; i < primeImp.size(); ++i){ // row iteration
-			if (primeImpChart[i][j] == true) {
-				x.insert(i);
-			}
-		}
-		patLogic.push_back(x);
-	}
 
-	/*cout << "\nPetric logic is (row: minterms no., col: prime implicants no.): " << endl;
-	for (int i = 0; i < patLogic.size(); ++i){
-		set<int > :: iterator itr;  // convert set to vector
-		for (itr = patLogic[i].begin(); itr != patLogic[i].end(); ++itr){
-			int x = *itr;
-        	cout << x << " ";
-    	}
-    	cout << endl;
-	}*/
-
-	// get all possible combinations
-	set< set<int> > posComb;
-	set<int> prod;
-	getPosComb(patLogic, 0, prod, posComb); // recursively multiply set elements
-	int min = 9999;
-
-	//cout << "\nPossible combinations that satisfy all minterms:" << endl;
-	set< set<int> > :: iterator itr1;
-	for (itr1 = posComb.begin(); itr1 != posComb.end(); ++itr1){
-		set<int> comb = *itr1;
-		if (comb.size() < min){
-			min = comb.size();
-		}
-		set<int > :: iterator itr;  
-		/*for (itr = comb.begin(); itr != comb.end(); ++itr){
-			int x = *itr;
-        	cout << x << " ";
-    	}
-    	cout << endl;*/
+	// Set cover: first the essential prime implicants (the only ones covering some minterm),
+	// then greedily the prime implicant covering more uncovered minterms (with fewer literals on ties)
+	vector<uint64_t> uncovered(nWords, 0);
+	for (int j = 0; j < minOnly.size(); ++j){
+		uncovered[j / 64] |= uint64_t(1) << (j % 64);
 	}
 
-	//cout << "\nGetting the combinations with min terms and min variables ..." << endl;
-	//Combinations with minimum terms
-	vector< set<int> > minComb;
-	set< set<int> > :: iterator itr;
-	for (itr = posComb.begin(); itr != posComb.end(); ++itr){
-		set<int> comb = *itr;
-		if (comb.size() == min) {
-			minComb.push_back(comb);
+	set<int> cover;
+	auto select = [&](int i) {
+		cover.insert(i);
+		for (int w = 0; w < nWords; ++w){
+			uncovered[w] &= ~primeImpChart[i][w];
+		}
+	};
+
+	for (int j = 0; j < minOnly.size(); ++j){
+		int only = -1, count = 0;
+		for (int i = 0; i < nPrimes && count < 2; ++i){
+			if ((primeImpChart[i][j / 64] >> (j % 64)) & 1) {
+				only = i;
+				count++;
+			}
 		}
+		if (count == 1)
+			select(only);
 	}
 
-	//Combinations with minimum variables
-	min = 9999;
-	for (int i = 0; i < minComb.size(); ++i){
-		if(util.getVar(minComb[i], primeImp) < min){
-			min = util.getVar(minComb[i], primeImp);
+	while (true){
+		int best = -1, bestCovered = 0;
+		for (int i = 0; i < nPrimes; ++i){
+			int covered = 0;
+			for (int w = 0; w < nWords; ++w){
+				covered += __builtin_popcountll(primeImpChart[i][w] & uncovered[w]);
+			}
+			if (covered > bestCovered || (covered == bestCovered && covered > 0 && numLiterals[i] < numLiterals[best])) {
+				best = i;
+				bestCovered = covered;
+			}
 		}
+		if (best == -1)
+			break;
+		select(best);
 	}
 
-	for (int i = 0; i < minComb.size(); ++i){
-		if(util.getVar(minComb[i], primeImp) == min){
-			functions.push_back(minComb[i]);
+	// remove the prime implicants made redundant by the ones selected after them
+	vector<int> selected(cover.begin(), cover.end());
+	for (int s = selected.size() - 1; s >= 0; --s){
+		int i = selected[s];
+		bool redundant = true;
+		for (int w = 0; w < nWords && redundant; ++w){
+			uint64_t others = 0;
+			for (int o : cover){
+				if (o != i)
+					others |= primeImpChart[o][w];
+			}
+			redundant = (primeImpChart[i][w] & ~others) == 0;
 		}
+		if (redundant)
+			cover.erase(i);
 	}
+
+	functions.push_back(cover);
 }
 
 
@@ -236,32 +253,30 @@ vector<string> Quine_McCluskey::getEssentialPrimeImpl() {
 	for(int i = 0; i < functions.size(); i++) {
 		set<int> function = functions[i];
 		set<int> ::iterator itr;
-		
+
 		for(itr = function.begin(); itr != function.end(); ++itr) {
 			int x = *itr;
 			essential_sum_of_products.push_back(primeImp[x]);
-		} 
+		}
 
-	} 
+	}
 
 	return essential_sum_of_products;
-} 
+}
 
 void Quine_McCluskey::displayFunctions(std::ofstream& dbg_file, std::string bool_function_name) {
 	dbg_file << "\n\n The possible functions for " << bool_function_name << ":\n";
 	for(int i = 0; i < functions.size(); i++) {
 		set<int> function = functions[i];
 		set<int> ::iterator itr;
-		
+
 		for(itr = function.begin(); itr != function.end(); ++itr) {
 			int x = *itr;
 			dbg_file << (primeImp[x]) << " + ";
-		} 
+		}
 
 		dbg_file << "\n";
-	} 
+	}
 
 	dbg_file << "\n\n";
 }
-
-
@@ -0,0 +1,59 @@
+#pragma once
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+//-------------------------------------------------------//
+
+// Reduced ordered binary decision diagrams (ROBDDs) of the boolean functions of
+// the BB conditions. The variables are the indices of the condition BBs, and they
+// are ordered by index. The nodes are unique (hash-consed), so two functions are
+// equal iff their nodes are equal, and all the operations are memoized. This keeps
+// the manipulation of the suppression conditions polynomial in the size of the BDDs.
+class BDD_Manager {
+
+public:
+	typedef int Node;
+
+	// a literal is a (variable, is_negated) pair and a product is a vector of literals
+	typedef std::pair<int, bool> Literal;
+	typedef std::vector<Literal> Product;
+
+	static const Node ZERO = 0;
+	static const Node ONE = 1;
+
+	BDD_Manager();
+
+	Node var(int var_index);
+	Node literal(int var_index, bool is_negated);
+
+	Node NOT(Node f);
+	Node AND(Node f, Node g);
+	Node OR(Node f, Node g);
+	Node ite(Node f, Node g, Node h);  // if f then g else h
+
+	// a sum of products (an empty sum is the constant 0, an empty product the constant 1)
+	Node fromSOP(const std::vector<Product>& sop);
+
+	// irredundant sum of products of f (Minato-Morreale), with the variables of each product in increasing order
+	std::vector<Product> toSOP(Node f);
+
+	int size() const { return nodes.size(); }
+
+private:
+	struct NodeData {
+		int var;  // variable of the node (TERMINAL_VAR for the constants)
+		Node low, high;  // cofactors for var = 0 and var = 1
+	};
+
+	static const int TERMINAL_VAR;
+
+	std::vector<NodeData> nodes;
+	std::map<std::tuple<int, Node, Node>, Node> unique_table;
+	std::map<std::tuple<Node, Node, Node>, Node> ite_cache;
+
+	Node mk(int var_index, Node low, Node high);
+	Node cofactor(Node f, int var_index, bool value) const;
+	Node isop(Node lower, Node upper, Product& cube, std::vector<Product>& cover);
+};
@@ -428,6 +428,8 @@ public:
 
 
 	bool calculate_F_Supp(std::ofstream& dbg_file, const std::vector<std::vector<pierCondition>>& f_prod, const std::vector<std::vector<pierCondition>>& f_cons, std::vector<std::vector<pierCondition>>& f_supp_simplified);
+	BDD_Manager::Node SOP_to_BDD(BDD_Manager& bdd, const std::vector<std::vector<pierCondition>>& f);
+	void BDD_to_SOP(BDD_Manager& bdd, BDD_Manager::Node f, std::vector<std::vector<pierCondition>>& f_sop);
 	bool simplify_if_repeated_conds(const std::vector<pierCondition>& one_product);
 	void new_binary_string_to_pierCondition_vec(const std::vector<std::string>& f_string, const std::vector<int>& condition_variables, std::vector<std::vector<pierCondition>>& f_vec);
 	
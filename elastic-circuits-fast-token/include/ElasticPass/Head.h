@@ -48,6 +48,7 @@
 
 #include "Quine_McCluskey.h"
 #include "Shannon_Expansion.h"
+#include "BDD.h"
 
 #include "llvm/Analysis/PostDominators.h"
 #include "llvm/Analysis/LoopInfo.h"
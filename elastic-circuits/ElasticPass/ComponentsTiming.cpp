@@ -10,23 +10,19 @@
 #include <sstream>
 #include <string>
 #include <vector>
-#include <regex>
 
 using namespace std;
 
 int get_component_index(std::string component) {
-
-    int component_indx = CMP_MAX;
-
-    if (!(component.empty())) {
+    static map<string, int> component_indices;
+    if (component_indices.empty()) {
         for (int indx = 0; indx < CMP_MAX; ++indx) {
-            if (!component.compare(components_name[indx])) {
-                component_indx = indx;
-                break;
-            }
+            component_indices.insert(make_pair(components_name[indx], indx));
         }
     }
-    return component_indx;
+
+    map<string, int>::const_iterator it = component_indices.find(component);
+    return it == component_indices.end() ? CMP_MAX : it->second;
 }
 
 int get_bitsize_index(int datasize) {
@@ -66,84 +62,53 @@ int get_bitsize_index(int datasize) {
 #define TARGET_PATH	"/etc/dynamatic/data/"
 
 
-float read_data_from_csv(int component_index, int bitsize_index, std::string data_type, std::string serial_number, int mode) {
-int offset = 0;
-
-    switch ( mode )
-{
-    	case DATA:
-	offset = 0;
-    break;
-   	 case VALID:
-	offset = 7;
-    break;
-    	case READY:
-	offset = 14;
-    break; 
-    	case VR:
-	offset = 21;
-	bitsize_index = 0; //All bitwidth point to the same location
-    break; 
-    	case CV:
-	offset = 22;
-	bitsize_index = 0; //All bitwidth point to the same location
-    break; 
-    	case CR:
-	offset = 23;
-	bitsize_index = 0; //All bitwidth point to the same location
-    break; 
-    	case VC:
-	offset = 24;
-	bitsize_index = 0; //All bitwidth point to the same location
-    break; 
-    	case VD:
-	offset = 25;
-	bitsize_index = 0; //All bitwidth point to the same location
-    break; 
- 	default:
-        offset = 0;
-    break;
-}
-    std::string dhls_path(std::getenv("DHLS_INSTALL_DIR"));
-    //std::string filename = dhls_path + "/etc/dynamatic/data/" + data_type + "/" + serial_number + "_" + data_type + ".csv";
-    std::string filename = dhls_path + "/etc/dynamatic/data/targets/" + serial_number + "_" + data_type + ".dat";
+TimingModel::TimingModel(const std::string& filename) : table(CMP_MAX * TIMING_COLUMNS, TIMING_DEFAULT_VALUE) {
     std::ifstream file(filename, std::ifstream::in);
 
-    float read_data = 10.0;
-    
-
-    if (!file) {
-        cerr << "Error opening " << filename << " use default values instead" << endl;
-        //filename = dhls_path + "/etc/dynamatic/data/" + data_type + "/" + "default_" + data_type + ".csv";
-        filename = dhls_path + "/etc/dynamatic/data/targets/" + "default_" + data_type + ".dat";
-        file = std::ifstream(filename, std::ifstream::in);
-    } 
-
     std::string line;
-    int max_index = component_index+1 > CMP_MAX ? CMP_MAX : component_index+1;
-    
-
-    for (int i = 0; i<max_index; ++i) {
-        std::getline(file, line);
+    for (int row = 0; row < CMP_MAX and std::getline(file, line); ++row) {
+        std::istringstream ss(line);
+        std::string value;
+        for (int col = 0; col < TIMING_COLUMNS and std::getline(ss, value, ','); ++col) {
+            table[row * TIMING_COLUMNS + col] = std::stof(value);
+        }
     }
-    
-    std::regex regex("\\,");
+}
 
-    std::vector<std::string> out(
-            std::sregex_token_iterator(line.begin(), line.end(), regex, -1),
-            std::sregex_token_iterator()
-    );
+const TimingModel& TimingModel::get(const std::string& serial_number, const std::string& data_type) {
+    static map<string, TimingModel*> models;
+
+    TimingModel*& model = models[serial_number + "_" + data_type];
+    if (model == nullptr) {
+        const char* dhls_env = std::getenv("DHLS_INSTALL_DIR");
+        std::string dhls_path(dhls_env == nullptr ? "" : dhls_env);
+        std::string filename = dhls_path + TARGET_PATH + "targets/" + serial_number + "_" + data_type + ".dat";
+        if (!std::ifstream(filename)) {
+            cerr << "Error opening " << filename << " use default values instead" << endl;
+            filename = dhls_path + TARGET_PATH + "targets/" + "default_" + data_type + ".dat";
+        }
+        model = new TimingModel(filename);
+    }
+    return *model;
+}
 
-//cout << " component_index " << component_index << " bitsize_index " << bitsize_index << " offset " << offset;
-//cout << " out[bitsize_index+offset] " << out[bitsize_index+offset] << endl;
+float TimingModel::lookup(int component_index, int bitsize_index, int mode) const {
+    // First column of each mode. The mixed connections have the same value for all bitwidths.
+    static const int offsets[] = {0, 7, 14, 21, 22, 23, 24, 25};
 
-   // if (  out[bitsize_index+offset] != NULL) 
-    	read_data = std::stof(out[bitsize_index+offset]);
+    int offset = 0;
+    if (mode >= DATA and mode <= VD) {
+        offset = offsets[mode];
+        if (mode >= VR) bitsize_index = 0;
+    }
 
-    file.close();
-    
+    // Unknown components take the values of the last row
+    int row = component_index < CMP_MAX ? component_index : CMP_MAX - 1;
+    return table[row * TIMING_COLUMNS + offset + bitsize_index];
+}
 
-    return read_data;
+float read_data_from_csv(int component_index, int bitsize_index, std::string data_type, std::string serial_number, int mode) {
+    return TimingModel::get(serial_number, data_type).lookup(component_index, bitsize_index, mode);
 }
 
 float get_component_delay(std::string component, int datasize, std::string serial_number, int mode) {
@@ -11,6 +11,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace llvm;
 using namespace std;
@@ -20,7 +21,6 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
     static char ID;
 
     static const string init_log_name;
-    static const string cond_log_name;
     static const string uncond_log_name;
     static const string report_log_name;
 
@@ -50,6 +50,32 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
         }
     }
 
+    // numbers the CFG edges of F: for each branch, in the order of the function,
+    // the true and false destinations of conditional branches, or the destination
+    // of unconditional ones. The edges are stored as (source, destination) BB IDs.
+    vector<int> number_edges(Function& F, map<BranchInst*, int>& first_edge) {
+        vector<int> edges;
+        string func_name = F.getName().str();
+        for (auto& BB : F) {
+            int BB_ID = BB_name_to_ID[BB.getName().str() + "_" + func_name];
+            for (auto& I : BB) {
+                if (auto* op = dyn_cast<BranchInst>(&I)) {
+                    first_edge[op] = edges.size() / 2;
+                    if (op->isConditional()) {
+                        edges.push_back(BB_ID);
+                        edges.push_back(BB_name_to_ID[op->getOperand(2)->getName().str() + "_" + func_name]);
+                        edges.push_back(BB_ID);
+                        edges.push_back(BB_name_to_ID[op->getOperand(1)->getName().str() + "_" + func_name]);
+                    } else {
+                        edges.push_back(BB_ID);
+                        edges.push_back(BB_name_to_ID[op->getOperand(0)->getName().str() + "_" + func_name]);
+                    }
+                }
+            }
+        }
+        return edges;
+    }
+
     virtual bool runOnFunction(Function& F) {
         // adding the function mapping to file for next stage
         string func_name = F.getName().str();
@@ -59,22 +85,14 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
         LLVMContext& context = F.getContext();
         Constant* init_func =
             F.getParent()->getOrInsertFunction(init_log_name, Type::getVoidTy(context),
-                                               Type::getInt32Ty(context), // function ID
-                                               Type::getInt32Ty(context)  // number of BBs
-            );
-        Constant* cond_func =
-            F.getParent()->getOrInsertFunction(cond_log_name, Type::getVoidTy(context),
-                                               Type::getInt32Ty(context), // function ID
-                                               Type::getInt1Ty(context),  // condition
-                                               Type::getInt32Ty(context), // source
-                                               Type::getInt32Ty(context), // true destination
-                                               Type::getInt32Ty(context)  // false destination
+                                               Type::getInt32Ty(context),   // function ID
+                                               Type::getInt32Ty(context),   // number of edges
+                                               Type::getInt32PtrTy(context) // source and destination of the edges
             );
         Constant* uncond_func =
             F.getParent()->getOrInsertFunction(uncond_log_name, Type::getVoidTy(context),
                                                Type::getInt32Ty(context), // function ID
-                                               Type::getInt32Ty(context), // source
-                                               Type::getInt32Ty(context)  // destination
+                                               Type::getInt32Ty(context)  // edge
             );
         Constant* report_func =
             F.getParent()->getOrInsertFunction(report_log_name, Type::getVoidTy(context));
@@ -82,6 +100,15 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
         // adding the BB mapping so as to achieve BB IDs
         add_function_BB_mapping(F);
 
+        // the table of the edges is a constant of the module, passed to the runtime by init
+        map<BranchInst*, int> first_edge;
+        vector<int> edges    = number_edges(F, first_edge);
+        vector<uint32_t> table(edges.begin(), edges.end());
+        Constant* table_init = ConstantDataArray::get(context, table);
+        GlobalVariable* edge_table =
+            new GlobalVariable(*F.getParent(), table_init->getType(), true,
+                               GlobalValue::PrivateLinkage, table_init, "freq_edges_" + func_name);
+
         bool flag = false;
         for (auto& BB : F) {
             // get BB and func IDs
@@ -95,8 +122,9 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
                 IRBuilder<> init_builder(&BB);
                 init_builder.SetInsertPoint(BB.getFirstNonPHI());
 
-                Value* init_args[] = {init_builder.getInt32(func_ID),
-                                      init_builder.getInt32(F.size())};
+                Value* init_args[] = {
+                    init_builder.getInt32(func_ID), init_builder.getInt32(edges.size() / 2),
+                    init_builder.CreateConstInBoundsGEP2_32(table_init->getType(), edge_table, 0, 0)};
 
                 init_builder.CreateCall(init_func, init_args);
             }
@@ -106,30 +134,15 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
                     IRBuilder<> builder(op);
                     builder.SetInsertPoint(&BB, builder.GetInsertPoint());
 
-                    if (op->isConditional()) {
-                        string BB_dst_true_name =
-                            op->getOperand(2)->getName().str() + "_" + func_name;
-                        string BB_dst_false_name =
-                            op->getOperand(1)->getName().str() + "_" + func_name;
-
-                        Value* cond      = op->getOperand(0);
-                        Value* src       = builder.getInt32(BB_ID);
-                        Value* dst_true  = builder.getInt32(BB_name_to_ID[BB_dst_true_name]);
-                        Value* dst_false = builder.getInt32(BB_name_to_ID[BB_dst_false_name]);
+                    // the taken edge of a conditional branch is selected by its condition
+                    Value* edge = builder.getInt32(first_edge[op]);
+                    if (op->isConditional())
+                        edge = builder.CreateSelect(op->getOperand(0), edge,
+                                                    builder.getInt32(first_edge[op] + 1));
 
-                        Value* args[] = {builder.getInt32(func_ID), cond, src, dst_true, dst_false};
+                    Value* args[] = {builder.getInt32(func_ID), edge};
 
-                        builder.CreateCall(cond_func, args);
-                    } else {
-                        string BB_dst_name = op->getOperand(0)->getName().str() + "_" + func_name;
-
-                        Value* src = builder.getInt32(BB_ID);
-                        Value* dst = builder.getInt32(BB_name_to_ID[BB_dst_name]);
-
-                        Value* args[] = {builder.getInt32(func_ID), src, dst};
-
-                        builder.CreateCall(uncond_func, args);
-                    }
+                    builder.CreateCall(uncond_func, args);
                     flag = true;
                 }
             }
@@ -154,7 +167,6 @@ struct FrequencyCounterPass : public llvm::FunctionPass {
 } // namespace
 
 const string FrequencyCounterPass::init_log_name   = "init";
-const string FrequencyCounterPass::cond_log_name   = "cond";
 const string FrequencyCounterPass::uncond_log_name = "uncond";
 const string FrequencyCounterPass::report_log_name = "report";
 
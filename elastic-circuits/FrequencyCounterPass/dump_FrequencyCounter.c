@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <inttypes.h>
+#include "log_FrequencyCounter.h"
+
+/*
+ * Prints a binary edge profile written by log_FrequencyCounter.c as text,
+ * one line per taken edge: function ID, source BB, destination BB and count.
+ * Usage: dump_FrequencyCounter [profile file, freq.bin by default]
+ */
+int main(int argc, char *argv[]){
+    const char *file_name = argc > 1 ? argv[1] : FREQ_PROFILE_FILE;
+    FILE *fp = fopen(file_name, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "couldn't open %s\n", file_name);
+        return 1;
+    }
+
+    struct freq_profile_header header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 || header.magic != FREQ_PROFILE_MAGIC) {
+        fprintf(stderr, "%s is not an edge profile\n", file_name);
+        return 1;
+    }
+    if (header.version != FREQ_PROFILE_VERSION) {
+        fprintf(stderr, "%s has version %u, expected %u\n", file_name, header.version, FREQ_PROFILE_VERSION);
+        return 1;
+    }
+
+    for (uint32_t f = 0; f < header.function_count; f++) {
+        struct freq_profile_function function;
+        if (fread(&function, sizeof(function), 1, fp) != 1) {
+            fprintf(stderr, "%s is truncated\n", file_name);
+            return 1;
+        }
+        for (uint32_t r = 0; r < function.record_count; r++) {
+            struct freq_profile_record record;
+            if (fread(&record, sizeof(record), 1, fp) != 1) {
+                fprintf(stderr, "%s is truncated\n", file_name);
+                return 1;
+            }
+            printf("%u %u %u %" PRIu64 "\n", function.func_ID, record.src, record.dst, record.count);
+        }
+    }
+
+    fclose(fp);
+    return 0;
+}
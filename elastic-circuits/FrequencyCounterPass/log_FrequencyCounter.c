@@ -1,51 +1,140 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#define MAX_FUNC_COUNT 100
-
-struct func_frequencies {
-    int initialized;
-    int BB_count;
-    int **frequencies;
-} ;
-
-struct func_frequencies profiler[MAX_FUNC_COUNT];
-
-void init(int func_ID, int BB_count){
-    if (profiler[func_ID].initialized == 1) return;
-    profiler[func_ID].initialized = 1;
-    profiler[func_ID].BB_count = BB_count;
-    profiler[func_ID].frequencies = malloc((BB_count + 1) * sizeof(int *));
-    for (int i = 1; i <= BB_count; i++) {
-        profiler[func_ID].frequencies[i] = malloc((BB_count + 1) * sizeof(int));
+#include "log_FrequencyCounter.h"
+
+/*
+ * Edge profiling runtime, called by the code instrumented by FrequencyCounterPass.
+ * The pass numbers the CFG edges of each function, so every function only needs
+ * one 64-bit counter per edge. Every thread counts in its own counters, without
+ * any synchronization, and the counters of all the threads are merged by report().
+ */
+
+/* Static description of a profiled function, registered by its first call */
+struct func_info {
+    int registered;
+    int edge_count;
+    const int *edges; /* source and destination BB of each edge */
+};
+
+/* Counters of one thread */
+struct thread_counters {
+    int capacity;      /* number of function IDs with a slot in counts */
+    uint64_t **counts; /* counts[func_ID][edge], NULL if not called by the thread */
+    struct thread_counters *next;
+};
+
+/* Shared state, only accessed with the lock held */
+static struct func_info *functions = NULL;
+static int function_capacity = 0;
+static struct thread_counters *all_threads = NULL;
+static char lock = 0;
+
+static __thread struct thread_counters *local = NULL;
+
+static void acquire(void) {
+    while (__atomic_test_and_set(&lock, __ATOMIC_ACQUIRE));
+}
+
+static void release(void) {
+    __atomic_clear(&lock, __ATOMIC_RELEASE);
+}
+
+/* Grows an array of pointers/structs to hold at least min_capacity elements */
+static void *grow(void *array, int *capacity, int min_capacity, size_t size) {
+    int new_capacity = *capacity > 0 ? *capacity : 16;
+    while (new_capacity < min_capacity) new_capacity *= 2;
+
+    array = realloc(array, new_capacity * size);
+    if (array == NULL) {
+        fprintf(stderr, "FrequencyCounter: out of memory\n");
+        exit(1);
     }
+    memset((char *) array + *capacity * size, 0, (new_capacity - *capacity) * size);
+    *capacity = new_capacity;
+    return array;
 }
 
-void uncond(int func_ID, int src, int dst){
-    profiler[func_ID].frequencies[src][dst]++;
+/* Called at the entry of every function: allocates the counters of the function
+   in the current thread the first time it is called by the thread */
+void init(int func_ID, int edge_count, const int *edges){
+    if (local != NULL && func_ID < local->capacity && local->counts[func_ID] != NULL) return;
+
+    acquire();
+
+    if (func_ID >= function_capacity)
+        functions = grow(functions, &function_capacity, func_ID + 1, sizeof(struct func_info));
+    functions[func_ID].registered = 1;
+    functions[func_ID].edge_count = edge_count;
+    functions[func_ID].edges = edges;
+
+    if (local == NULL) {
+        local = calloc(1, sizeof(struct thread_counters));
+        local->next = all_threads;
+        all_threads = local;
+    }
+    if (func_ID >= local->capacity)
+        local->counts = grow(local->counts, &local->capacity, func_ID + 1, sizeof(uint64_t *));
+
+    /* at least one counter, so that the slot is not NULL */
+    local->counts[func_ID] = calloc(edge_count > 0 ? edge_count : 1, sizeof(uint64_t));
+
+    release();
 }
 
-void cond(int func_ID, int condition, int src, int dst_true, int dst_false){
-    if (condition) profiler[func_ID].frequencies[src][dst_true]++;
-    else profiler[func_ID].frequencies[src][dst_false]++;
+/* Called on every branch, with the static ID of the taken edge */
+void uncond(int func_ID, int edge){
+    local->counts[func_ID][edge]++;
 }
 
+/* Merges the counters of all the threads and writes them in FREQ_PROFILE_FILE */
 void report(){
-    for (int func_ID = 0; func_ID < MAX_FUNC_COUNT; func_ID++) {
-        if (profiler[func_ID].initialized != 1) continue;
-
-        char file_name[20];
-        sprintf(file_name, "%d_freq.txt", func_ID);
-        FILE *fp = fopen(file_name, "w");
-
-        int size = profiler[func_ID].BB_count;
-        for (int i = 1; i <= size; i++) {
-            for (int j = 1; j <= size; j++) {
-                if (profiler[func_ID].frequencies[i][j] > 0) {
-                    fprintf(fp, "%d %d %d\n", i, j, profiler[func_ID].frequencies[i][j]);
-                }
-            }
+    acquire();
+
+    FILE *fp = fopen(FREQ_PROFILE_FILE, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "FrequencyCounter: couldn't open %s\n", FREQ_PROFILE_FILE);
+        release();
+        return;
+    }
+
+    struct freq_profile_header header = {FREQ_PROFILE_MAGIC, FREQ_PROFILE_VERSION, 0};
+    for (int func_ID = 0; func_ID < function_capacity; func_ID++) {
+        if (functions[func_ID].registered) header.function_count++;
+    }
+    fwrite(&header, sizeof(header), 1, fp);
+
+    uint64_t *total = NULL;
+    int total_capacity = 0;
+
+    for (int func_ID = 0; func_ID < function_capacity; func_ID++) {
+        const struct func_info *info = &functions[func_ID];
+        if (!info->registered) continue;
+
+        if (info->edge_count > total_capacity)
+            total = grow(total, &total_capacity, info->edge_count, sizeof(uint64_t));
+        if (info->edge_count > 0) memset(total, 0, info->edge_count * sizeof(uint64_t));
+
+        for (struct thread_counters *t = all_threads; t != NULL; t = t->next) {
+            if (func_ID >= t->capacity || t->counts[func_ID] == NULL) continue;
+            for (int e = 0; e < info->edge_count; e++) total[e] += t->counts[func_ID][e];
+        }
+
+        struct freq_profile_function function = {func_ID, info->edge_count, 0};
+        for (int e = 0; e < info->edge_count; e++) {
+            if (total[e] > 0) function.record_count++;
+        }
+        fwrite(&function, sizeof(function), 1, fp);
+
+        for (int e = 0; e < info->edge_count; e++) {
+            if (total[e] == 0) continue;
+            struct freq_profile_record record = {info->edges[2*e], info->edges[2*e + 1], total[e]};
+            fwrite(&record, sizeof(record), 1, fp);
         }
-        fclose(fp);
     }
-}
\ No newline at end of file
+
+    free(total);
+    fclose(fp);
+
+    release();
+}
@@ -0,0 +1,41 @@
+#ifndef LOG_FREQUENCY_COUNTER_H
+#define LOG_FREQUENCY_COUNTER_H
+
+#include <stdint.h>
+
+/*
+ * Binary edge profile written by the runtime (log_FrequencyCounter.c) at the end of main,
+ * read by FrequencyDataGatherPass and printed by dump_FrequencyCounter:
+ *
+ *   header   : magic, version, number of functions         (freq_profile_header)
+ *   function : function ID, number of edges and of records (freq_profile_function)
+ *   record   : source BB, destination BB, count            (freq_profile_record)
+ *
+ * Each function is followed by its records, one per edge taken at least once.
+ * The function IDs are the ones of mapping.txt and the BBs are numbered from 1,
+ * in the order of the function. All the values are in the byte order of the host.
+ */
+
+#define FREQ_PROFILE_FILE "freq.bin"
+#define FREQ_PROFILE_MAGIC 0x51455246u /* "FREQ" */
+#define FREQ_PROFILE_VERSION 1u
+
+struct freq_profile_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t function_count;
+};
+
+struct freq_profile_function {
+    uint32_t func_ID;
+    uint32_t edge_count;
+    uint32_t record_count;
+};
+
+struct freq_profile_record {
+    uint32_t src;
+    uint32_t dst;
+    uint64_t count;
+};
+
+#endif
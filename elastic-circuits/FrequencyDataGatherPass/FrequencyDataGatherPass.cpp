@@ -11,6 +11,9 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
+
+#include "../FrequencyCounterPass/log_FrequencyCounter.h"
 
 using namespace llvm;
 using namespace std;
@@ -21,11 +24,14 @@ struct FrequencyGatherDataPass : public llvm::FunctionPass {
     static char ID;
 
     ifstream mapping_file;
-    map<string, string> function_to_file;
+    map<string, int> function_to_ID;
+
+    // taken edges of each function ID, read from the binary profile
+    map<int, vector<freq_profile_record>> profile;
 
     map<string, int> bb_name_to_ID;
 
-    map<pair<int, int>, int> edge_freqs;
+    map<pair<int, int>, uint64_t> edge_freqs;
 
     int previous_bb_count;
 
@@ -42,9 +48,11 @@ struct FrequencyGatherDataPass : public llvm::FunctionPass {
             string function_name;
             int function_number;
             iss >> function_name >> function_number;
-            function_to_file[function_name] = to_string(function_number) + "_freq.txt";
+            function_to_ID[function_name] = function_number;
         }
 
+        read_profile();
+
         previous_bb_count = 0;
         bb_name_to_ID.clear();
         edge_freqs.clear();
@@ -90,26 +98,55 @@ struct FrequencyGatherDataPass : public llvm::FunctionPass {
         }
     }
 
+    // reads the binary profile written by the runtime (see log_FrequencyCounter.h)
+    void read_profile() {
+        ifstream file(FREQ_PROFILE_FILE, ios::binary);
+        if (!file) {
+            errs() << "couldn't open file " << FREQ_PROFILE_FILE << "\n";
+            return;
+        }
+
+        freq_profile_header header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != FREQ_PROFILE_MAGIC || header.version != FREQ_PROFILE_VERSION) {
+            errs() << FREQ_PROFILE_FILE << " is not an edge profile of version "
+                   << FREQ_PROFILE_VERSION << "\n";
+            return;
+        }
+
+        for (uint32_t f = 0; f < header.function_count; f++) {
+            freq_profile_function function;
+            if (!file.read(reinterpret_cast<char*>(&function), sizeof(function)))
+                break;
+
+            vector<freq_profile_record>& records = profile[function.func_ID];
+            records.resize(function.record_count);
+            if (!file.read(reinterpret_cast<char*>(records.data()),
+                           function.record_count * sizeof(freq_profile_record)))
+                break;
+        }
+        if (!file)
+            errs() << FREQ_PROFILE_FILE << " is truncated\n";
+    }
+
     void read_freq_from_file(string function_name) {
-        if (function_to_file.find(function_name) == function_to_file.end()) {
-            errs() << "don't know which file to read for function " << function_name << "\n";
+        if (function_to_ID.find(function_name) == function_to_ID.end()) {
+            errs() << "don't know the ID of function " << function_name << "\n";
             return;
         }
 
-        ifstream file_freq(function_to_file[function_name].c_str());
-        if (!file_freq)
+        auto it = profile.find(function_to_ID[function_name]);
+        if (it == profile.end())
             return;
 
-        string line;
-        while (getline(file_freq, line)) {
-            stringstream iss(line);
-            int src, dst, freq;
-            iss >> src >> dst >> freq;
+        // a conditional branch with the same destinations has two edges with the same BBs
+        for (auto& record : it->second) {
+            int src = record.src, dst = record.dst;
             if (edge_freqs.find({src, dst}) == edge_freqs.end()) {
                 errs() << "there is no edge between " << src << " and " << dst << "\n";
                 return;
             }
-            edge_freqs[{src, dst}] = freq;
+            edge_freqs[{src, dst}] += record.count;
         }
     }
 
@@ -122,7 +159,8 @@ struct FrequencyGatherDataPass : public llvm::FunctionPass {
         }
 
         for (auto& edge : edge_freqs) {
-            int src = edge.first.first, dst = edge.first.second, freq = edge.second;
+            int src = edge.first.first, dst = edge.first.second;
+            uint64_t freq = edge.second;
             src += previous_bb_count;
             dst += previous_bb_count;
             string line =
@@ -147,6 +147,11 @@ int ScopMeta::getMaxCommonDepth(const Instruction* I0, const Instruction* I1) {
 isl::map ScopMeta::getMap(const Instruction* Inst, const unsigned int depthToKeep,
                           const bool getFuture) {
 
+    auto key = std::make_tuple(Inst, depthToKeep, getFuture);
+    auto it  = MapCache.find(key);
+    if (it != MapCache.end())
+        return it->second;
+
     const auto currentMap = InstToCurrentMap[Inst];
 
     const unsigned int in_dims = currentMap.dim(isl::dim::in);
@@ -156,7 +161,9 @@ isl::map ScopMeta::getMap(const Instruction* Inst, const unsigned int depthToKee
     if (getFuture && depthToKeep > 0) {
         retMap = make_future_map(retMap);
     }
-    return removeMapMeta(retMap);
+    retMap = removeMapMeta(retMap);
+    MapCache.emplace(key, retMap);
+    return retMap;
 }
 
 isl::map ScopMeta::removeMapMeta(isl::map map) {
@@ -244,6 +251,7 @@ ScopMeta::ScopMeta(Scop& S) : S(S), TDI(*S.getLI()) {
 
 ScopMeta::~ScopMeta() {
     InstToCurrentMap.clear();
+    MapCache.clear();
     isl_ctx_free(ctx->release());
 }
 
@@ -266,6 +274,7 @@ void ScopMeta::addScopStmt(ScopStmt& Stmt) {
 
             InstToLoopDepth[Inst] = depth;
             InstToBase[Inst]      = MA.getOriginalBaseAddr();
+            BaseToMemInsts[InstToBase[Inst]].push_back(Inst);
             MemInsts.push_back(Inst);
         }
 }
@@ -302,15 +311,11 @@ void ScopMeta::computeIntersections() {
         * */
         // clang-format on
 
-        for (auto Inst : MemInsts) {
+        /* No need to check between different arrays */
+        for (auto Inst : BaseToMemInsts[InstToBase[WrInst]]) {
             /* Skip checking with self */
             if (Inst == WrInst)
                 continue;
-            /* No need to check between different arrays */
-            if (InstToBase[Inst] != InstToBase[WrInst]) {
-                DEBUG(dbgs() << "Skipping:Diff bases " << *Inst << " and " << *WrInst << "\n");
-                continue;
-            }
 
             const int CommonDepth = getMaxCommonDepth(Inst, WrInst);
 
@@ -319,12 +324,12 @@ void ScopMeta::computeIntersections() {
 
             isl::map InstMap, WrInstMap;
 
-            bool depends = TDI.hasTokenDependence(WrInst, Inst) ||
-                           TDI.hasRevTokenDependence(Inst, WrInst) ||
-                           TDI.hasControlDependence(WrInst, Inst);
-
             /* Only WrInst may only depend on Inst if Inst is a load */
-            if (RdInst != nullptr && depends) {
+            bool depends = RdInst != nullptr && (TDI.hasTokenDependence(WrInst, Inst) ||
+                                                 TDI.hasRevTokenDependence(Inst, WrInst) ||
+                                                 TDI.hasControlDependence(WrInst, Inst));
+
+            if (depends) {
                 /* Consecutive top-level loops will finish the load before any
                  * store, since there is an operand dependency */
                 if (CommonDepth == 0 && scopMinDepth == 1)
@@ -184,19 +184,24 @@ void MemElemInfoPass::processLoop(Loop* L) {
 
 void MemElemInfoPass::createSets(struct TLLMeta& LM) {
     std::list<instPairT> intersectList;
-    auto rdInstrSet = LM.rdInsts;
-    auto wrInstrSet = LM.wrInsts;
 
-    for (auto wrInst : wrInstrSet) {
+    /* Each base array is emitted as a separate RAM in the design. Two
+     * instructions targetting differing base arrays can never depend,
+     * so the accesses are bucketed by base array and only pairs within
+     * a bucket are checked */
+    std::map<const Value*, std::vector<const Instruction*>> rdByBase, wrByBase;
+    for (auto rdInst : LM.rdInsts)
+        rdByBase[findBase(rdInst)].push_back(rdInst);
+    for (auto wrInst : LM.wrInsts)
+        wrByBase[findBase(wrInst)].push_back(wrInst);
+
+    for (auto wrInst : LM.wrInsts) {
+        const Value* base = findBase(wrInst);
+
         /* Find RAW dependencies */
-        for (auto rdInst : rdInstrSet) {
+        for (auto rdInst : rdByBase[base]) {
             auto pair = instPairT(wrInst, rdInst);
 
-            /* Each base array is emitted as a separate RAM in the design. Two
-             * instructions targetting differing base arrays can never depend */
-            if (!equalBase(wrInst, rdInst))
-                continue;
-
             /*  If both instructions are in the same scop,
                 use the result from IndexAnalysis */
             auto rdIt = LM.instToScop.find(rdInst);
@@ -221,15 +226,10 @@ void MemElemInfoPass::createSets(struct TLLMeta& LM) {
                 intersectList.push_back(pair);
         }
         /* Find WAW dependencies */
-        for (auto wrInst1 : wrInstrSet) {
+        for (auto wrInst1 : wrByBase[base]) {
             if (wrInst1 == wrInst)
                 continue;
 
-            /* Each base array is emitted as a separate RAM in the design. Two
-             * instructions targetting differing base arrays can never depend */
-            if (!equalBase(wrInst, wrInst1))
-                continue;
-
             auto pair    = instPairT(wrInst1, wrInst);
             auto pairRev = instPairT(wrInst, wrInst1);
             /*  If both instructions are in the same scop,
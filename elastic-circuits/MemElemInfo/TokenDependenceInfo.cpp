@@ -182,6 +182,15 @@ static bool tokenRevDepends(Path P, const Instruction* I_A, const std::set<Loop*
 } // namespace
 
 bool TokenDependenceInfo::hasTokenDependence(const Instruction* I_B, const Instruction* I_A) {
+    auto query = QueryT(I_B, I_A);
+    auto it    = tokenDepCache.find(query);
+    if (it != tokenDepCache.end())
+        return it->second;
+
+    /* Every path explored by tokenDepends goes backwards from I_B and must
+     * end in the BB of I_A, so there is no dependence if it is unreachable */
+    if (!reaches(I_A->getParent(), I_B->getParent()))
+        return tokenDepCache[query] = false;
 
     Path P;
     auto BB = I_B->getParent();
@@ -193,10 +202,15 @@ bool TokenDependenceInfo::hasTokenDependence(const Instruction* I_B, const Instr
         LS.insert(L);
 
     DEBUG(dbgs() << "I_B = " << *I_B << " depends " << *I_A << " ? \n");
-    return tokenDepends(P, I_A, LS);
+    return tokenDepCache[query] = tokenDepends(P, I_A, LS);
 }
 
 bool TokenDependenceInfo::hasRevTokenDependence(const Instruction* I_A, const Instruction* I_B) {
+    auto query = QueryT(I_A, I_B);
+    auto it    = revTokenDepCache.find(query);
+    if (it != revTokenDepCache.end())
+        return it->second;
+
     Path P;
     auto BB = I_A->getParent();
     P.Blocks.push_back(BB);
@@ -207,9 +221,47 @@ bool TokenDependenceInfo::hasRevTokenDependence(const Instruction* I_A, const In
         LS.insert(L);
 
     DEBUG(dbgs() << "I_A = " << *I_A << " revdeps " << *I_B << " ? \n");
-    return tokenRevDepends(P, I_B, LS);
+    return revTokenDepCache[query] = tokenRevDepends(P, I_B, LS);
 }
 
 bool TokenDependenceInfo::hasControlDependence(const Instruction* I_A, const Instruction* I_B) {
     return false;
 }
+
+bool TokenDependenceInfo::reaches(const BasicBlock* From, const BasicBlock* To) {
+    const Function* F = From->getParent();
+    if (F != To->getParent())
+        return false;
+    if (F != reachF)
+        computeReachability(*F);
+
+    return reachMatrix[BBIndex[From]].test(BBIndex[To]);
+}
+
+void TokenDependenceInfo::computeReachability(const Function& F) {
+    reachF = &F;
+    BBIndex.clear();
+    unsigned nBBs = 0;
+    for (const auto& BB : F)
+        BBIndex[&BB] = nBBs++;
+
+    /* One DFS per BB, each BB reaches itself */
+    reachMatrix.assign(nBBs, BitVector(nBBs));
+    std::vector<const BasicBlock*> stack;
+    for (const auto& BB : F) {
+        BitVector& reach = reachMatrix[BBIndex[&BB]];
+        reach.set(BBIndex[&BB]);
+        stack.push_back(&BB);
+        while (!stack.empty()) {
+            const BasicBlock* CurBB = stack.back();
+            stack.pop_back();
+            for (auto succBB : successors(CurBB)) {
+                const unsigned succ = BBIndex[succBB];
+                if (!reach.test(succ)) {
+                    reach.set(succ);
+                    stack.push_back(succBB);
+                }
+            }
+        }
+    }
+}
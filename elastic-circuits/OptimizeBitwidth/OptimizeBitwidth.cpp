@@ -100,34 +100,47 @@ bool OptimizeBitwidth::runOnFunction(Function& F) {
 
     // Algorithm : 
     //do a forward pass through all the instructions, then a backward pass
-    //reiterate while there are any changes in bitwidths
-    bool run_again = true;
+    //then only revisit the values reading an Info which changed (see valueChanged),
+    //forward in program order and backward in reverse order, until both worklists are empty
+    initializeWorklists(F);
+
     int iteration = 0;
-    //while (run_again && iteration < MAX_ITERATIONS) {
-    while (run_again) {
-        run_again = false;
+    while (!forward_list.empty() || !backward_list.empty()) {
 
         logger.log("runOnFunction : iteration %", iteration);
 
         logger.log("Forward pass");
         logger.pushIndent();
 
-        // run forward pass on every instruction
-        for (auto I = inst_begin(F), E = inst_end(F); I != E; ++I)
-            run_again |= forward(&*I);
+        while (!forward_list.empty()) {
+            const Value* v = ordered_values[*forward_list.begin()];
+            forward_list.erase(forward_list.begin());
+
+            if (widened.count(v) != 0)
+                continue;
+
+            forward_visits += 1;
+            if (forward(cast<Instruction>(v)))
+                valueChanged(v, true);
+        }
             
         logger.popIndent();
 
         logger.log("Backward pass");
         logger.pushIndent();
 
-        // run backward pass on every value, don't forget arguments!
-        for (auto BB = F.getBasicBlockList().rbegin(), bbEnd = F.getBasicBlockList().rend() ; BB != bbEnd ; ++BB)
-            for (auto I = BB->rbegin(), iEnd = BB->rend() ; I != iEnd ; ++I)
-                run_again |= backward(&*I);
-                
-        for (const Argument& a : F.args())
-            run_again |= backward(&a);
+        // arguments are first in the order, so they are visited after the instructions
+        while (!backward_list.empty()) {
+            const Value* v = ordered_values[*backward_list.begin()];
+            backward_list.erase(backward_list.begin());
+
+            if (widened.count(v) != 0)
+                continue;
+
+            backward_visits += 1;
+            if (backward(v))
+                valueChanged(v, false);
+        }
 
         logger.popIndent();
 
@@ -144,6 +157,80 @@ bool OptimizeBitwidth::runOnFunction(Function& F) {
 }
 
 
+void OptimizeBitwidth::initializeWorklists(const Function& F) {
+    order.clear();
+    ordered_values.clear();
+    header_changes.clear();
+    widened.clear();
+    forward_visits = backward_visits = 0;
+
+    for (const Argument& a : F.args()) {
+        order[&a] = ordered_values.size();
+        ordered_values.push_back(&a);
+    }
+
+    for (auto I = inst_begin(F), E = inst_end(F); I != E; ++I) {
+        order[&*I] = ordered_values.size();
+        ordered_values.push_back(&*I);
+    }
+
+    // the first iteration visits everything, like a full forward and backward sweep
+    for (unsigned i = 0 ; i < ordered_values.size() ; ++i) {
+        if (isa<Instruction>(ordered_values[i]))
+            forward_list.insert(i);
+        backward_list.insert(i);
+    }
+}
+
+void OptimizeBitwidth::enqueueForward(const Value* v) {
+    // only the instructions of the function have a forward function
+    auto it = order.find(v);
+    if (it != order.end() && isa<Instruction>(v))
+        forward_list.insert(it->second);
+}
+
+void OptimizeBitwidth::enqueueBackward(const Value* v) {
+    // constants, globals and labels are never refined backward
+    auto it = order.find(v);
+    if (it != order.end())
+        backward_list.insert(it->second);
+}
+
+void OptimizeBitwidth::valueChanged(const Value* v, bool in_forward) {
+    // Widening : a loop header phi which keeps changing stops being refined.
+    //Infos only shrink, so the current one is a safe (bigger) approximation,
+    //and the number of iterations around the loop is bounded
+    if (const PHINode* phi = dyn_cast<PHINode>(v)) {
+        LoopInfo& LI = getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+        if (LI.isLoopHeader(phi->getParent()) && ++header_changes[v] >= WIDENING_THRESHOLD) {
+            logger.log("Widening loop header phi % after % changes", bit_stats[v]->name, header_changes[v]);
+            widened.insert(v);
+        }
+    }
+
+    // forward(v) reads the Info of v and its operands, so it is only stale after a backward change;
+    //the forward functions of the users of v and of the loop iterators bounded by v are stale too
+    if (!in_forward)
+        enqueueForward(v);
+    for (const User* u : v->users())
+        enqueueForward(u);
+    if (loop_users.count(v) != 0)
+        for (const Instruction* I : loop_users.at(v))
+            enqueueForward(I);
+
+    // backward(x) reads the Info of x, of its users and of their operands :
+    //v itself, the operands of v (v is their user) and the other operands of the users of v
+    enqueueBackward(v);
+    if (const Instruction* I = dyn_cast<Instruction>(v))
+        for (const Value* op : I->operand_values())
+            enqueueBackward(op);
+    for (const User* u : v->users())
+        if (isa<Instruction>(u))
+            for (const Value* op : u->operand_values())
+                enqueueBackward(op);
+}
+
+
 void OptimizeBitwidth::init(const Function& F) {
     logger.log("1. Initialization");
     
@@ -385,6 +472,12 @@ void OptimizeBitwidth::initializeLoop(const Loop* L, const LoopInfo& LI, Dominat
     loop_deps.insert({ indVar, deps });
     loop_deps.insert({ stepInst, deps });
 
+    // the iterators must be revisited when the Infos of their bounds change
+    for (const Value* v : { deps.initValue(), deps.boundValue(), deps.stepOffset() }) {
+        loop_users[v].push_back(indVar);
+        loop_users[v].push_back(stepInst);
+    }
+
     logger.log("LoopDeps set for indVar '%' and stepInst '%'.", indVar->getName(), stepInst->getName());
 }
 
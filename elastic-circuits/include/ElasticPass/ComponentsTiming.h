@@ -39,6 +39,7 @@
 
 
 #include <string>
+#include <vector>
 
 enum {
     ICMP_INDX,
@@ -190,6 +191,33 @@ static const int datapath_latency[CMP_MAX + 1][10] = {
     {0, 0, 0, 0, 0, 0, 0},        // cmp_none
 };
 
+// Columns of a row of a target delay file: the delays of the 7 bitwidths for
+// DATA, VALID and READY, followed by one delay for each mixed connection (VR..VD)
+#define TIMING_COLUMNS 26
+#define TIMING_DEFAULT_VALUE 10.0
+
+/**
+ * Timing data of a target (data/targets/<serial>_<type>.dat), read once and
+ * stored as a dense table of CMP_MAX rows and TIMING_COLUMNS columns.
+ * Missing values (short rows or files) are set to TIMING_DEFAULT_VALUE.
+ */
+class TimingModel {
+public:
+    /**
+     * Returns the timing model of a target, which is read on the first call.
+     * If the file of the target does not exist, the default target is used.
+     */
+    static const TimingModel& get(const std::string& serial_number, const std::string& data_type);
+
+    /** Value for a component (index), bitwidth (index) and mode (DATA, VALID, ..., VD). */
+    float lookup(int component_index, int bitsize_index, int mode) const;
+
+private:
+    explicit TimingModel(const std::string& filename);
+
+    std::vector<float> table; // CMP_MAX x TIMING_COLUMNS, by rows
+};
+
 #define ROUTING_DELAY_0 1.0
 #define ROUTING_DELAY_10 1.1
 #define ROUTING_DELAY_20 1.2
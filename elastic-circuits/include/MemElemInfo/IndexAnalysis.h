@@ -7,6 +7,7 @@
 #include "MemElemInfo/TokenDependenceInfo.h"
 #include "polly/ScopInfo.h"
 #include <stdexcept>
+#include <tuple>
 
 using namespace polly;
 
@@ -24,6 +25,10 @@ class ScopMeta {
     std::set<instPairT> Intersections;
     std::set<instPairT> nonIntersections;
     std::map<const Instruction*, const Value*> InstToBase;
+    /* Memory instructions accessing each base array, in the order of MemInsts */
+    std::map<const Value*, std::vector<const Instruction*>> BaseToMemInsts;
+    /* Maps already returned by getMap(), for each (Inst, depthToKeep, getFuture) */
+    std::map<std::tuple<const Instruction*, unsigned int, bool>, isl::map> MapCache;
     /* Each Minimized Scop has a separate context. This ensures that
      * trying to intersect maps for instructions from separate Scops
      * will raise an error */
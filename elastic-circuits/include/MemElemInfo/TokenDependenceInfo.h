@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/IR/Instructions.h"
+#include <map>
 #include <set>
+#include <vector>
 
 using namespace llvm;
 
@@ -28,6 +32,23 @@ public:
 
     bool hasControlDependence(const Instruction* I1, const Instruction* I0);
 
+    /// Query whether there is a CFG path (possibly empty) from @p From to @p To
+    bool reaches(const BasicBlock* From, const BasicBlock* To);
+
 private:
+    typedef std::pair<const Instruction*, const Instruction*> QueryT;
+
     const LoopInfo& LI;
+
+    /// Answers of the previous queries
+    std::map<QueryT, bool> tokenDepCache;
+    std::map<QueryT, bool> revTokenDepCache;
+
+    /// Reachability matrix of the BBs of the function, computed on the first query:
+    /// reachMatrix[BBIndex[A]][BBIndex[B]] is set iff B is reachable from A
+    const Function* reachF = nullptr;
+    DenseMap<const BasicBlock*, unsigned> BBIndex;
+    std::vector<BitVector> reachMatrix;
+
+    void computeReachability(const Function& F);
 };
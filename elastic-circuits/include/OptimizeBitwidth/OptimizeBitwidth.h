@@ -45,6 +45,9 @@ public:
 
     static const int MAX_ITERATIONS = 5;
 
+    // number of changes of a loop header phi after which it is widened (no longer refined)
+    static const unsigned WIDENING_THRESHOLD = 16;
+
     // set or unset to enable/disable the pass
     static void setEnabled(bool enable);
     static bool isEnabled();
@@ -88,6 +91,18 @@ private: // backward functions (see backward.cpp)
     void constructBackwardFunctions();
     void backwardXor(Info* acc, const Instruction* I, unsigned int targetOp);
 
+private: // worklists (see runOnFunction)
+
+    // Indexes the arguments and instructions of F in program order and fills both worklists
+    void initializeWorklists(const Function& F);
+
+    void enqueueForward(const Value* v);
+    void enqueueBackward(const Value* v);
+
+    // Called when the Info of v changed: widens the loop header phis,
+    //and enqueues the values whose forward/backward functions read the Info of v
+    void valueChanged(const Value* v, bool in_forward);
+
 private: // Boring initialization stuff
 
     void init(const Function& F);
@@ -141,8 +156,23 @@ private: // make public for tests
     //to bound loop iterators and 
     std::map<const Value*, LoopDeps> loop_deps;
 
+    // map from llvm::Value* to the loop iterators whose LoopDeps read its Info
+    std::map<const Value*, std::vector<const Instruction*>> loop_users;
+
+    // position of the arguments (first) and instructions of the function,
+    //so that the worklists are visited in program order (forward) or reverse order (backward)
+    std::unordered_map<const Value*, unsigned> order;
+    std::vector<const Value*> ordered_values;
+    std::set<unsigned> forward_list;
+    std::set<unsigned, std::greater<unsigned>> backward_list;
+
+    // number of changes of each loop header phi, and the phis widened after WIDENING_THRESHOLD changes
+    std::unordered_map<const Value*, unsigned> header_changes;
+    std::unordered_set<const Value*> widened;
+
     // for statistics
     std::map<const Value*, Stats*> bit_stats;
+    unsigned forward_visits = 0, backward_visits = 0;
 };
 
 template <class OStream>
@@ -212,6 +242,12 @@ void OptimizeBitwidth::printStats(const Function& F, OStream& os, unsigned itera
     os << "Saved bits in constants : " << original - total_opti - saved_fdw - saved_bwd << '\n'; 
     os << "Used bits after OB : " << total_opti <<  ", vs. Originaly used bits : " << original << '\n';
     os << " => Reduction of used bits : " << static_cast<float>(total_opti) / original * 100 << '\n';
+
+    // the first iteration visits every instruction forward, and every instruction and argument backward
+    unsigned first_visits = 2 * ordered_values.size() - F.arg_size();
+    os << "Forward visits : " << forward_visits << ", backward visits : " << backward_visits
+        << ", revisits after the first iteration : " << forward_visits + backward_visits - first_visits << '\n';
+    os << "Widened loop header phis : " << widened.size() << '\n';
 }
 
 #endif // OPTIMIZE_BITWIDTH_H
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include "ErrorManager.h"
 #include "MILP_Model.h"
@@ -22,11 +23,15 @@ string command;
 struct user_input {
     string graph_name;
     int case_selection;
+    vector<int> batch_cases;    // Cases computed in one run (-case=all or -case=0,1,2)
+    int bench_iterations;
 };
 
 void clear_input(user_input& input) {
     input.graph_name = "dataflow";
     input.case_selection = 0;
+    input.batch_cases.clear();
+    input.bench_iterations = 0;
 }
 
 void print_input(const user_input& input) {
@@ -38,7 +43,14 @@ void print_input(const user_input& input) {
     cout << "\n================================================" << endl;
     cout << "                    LSQ-Sizing" << endl;
     cout << "dataflow graph name: " << input.graph_name << endl;
-    cout << "case-selection: " << selected_case << endl;
+    if (input.batch_cases.empty()) {
+        cout << "case-selection: " << selected_case << endl;
+    } else {
+        cout << "case-selection: batch (";
+        for (int i = 0; i < input.batch_cases.size(); i++) cout << (i ? ", " : "") << input.batch_cases[i];
+        cout << ")" << endl;
+    }
+    if (input.bench_iterations > 0) cout << "benchmark iterations: " << input.bench_iterations << endl;
     cout << "================================================" << endl;
 }
 
@@ -46,9 +58,27 @@ void parse_user_input(const vecParams& params, user_input& input) {
     clear_input(input);
     regex name_regex("(-filepath=)(.*)");
     regex case_regex("(-case)(.*)");
+    regex bench_regex("(-bench=)(.*)");
     for (auto param: params) {
-        if (regex_match(param, case_regex)) {
-            input.case_selection = atof(param.substr(param.find("=") + 1).c_str());
+        if (regex_match(param, bench_regex)) {
+            input.bench_iterations = atoi(param.substr(param.find("=") + 1).c_str());
+        } else if (regex_match(param, case_regex)) {
+            string value = param.substr(param.find("=") + 1);
+            if (value == "all") {
+                input.batch_cases = {0, 1, 2};
+            } else if (value.find(',') != string::npos) {
+                stringstream cases(value);
+                string sel_case;
+                while (getline(cases, sel_case, ',')) {
+                    input.batch_cases.push_back(atoi(sel_case.c_str()));
+                    if (input.batch_cases.back() < 0 or input.batch_cases.back() > 2) {
+                        cout << "[ERROR] " << sel_case << " is invalid case" << endl;
+                        assert(false);
+                    }
+                }
+            } else {
+                input.case_selection = atof(value.c_str());
+            }
         } else if (regex_match(param, name_regex)) {
             input.graph_name = param.substr(param.find("=") + 1);
         } else {
@@ -150,6 +180,32 @@ int lsq_sizing(const vecParams& params) {
     parse_user_input(params, input);
     print_input(input);
 
+    // Benchmark of the path searches, the LSQs are not sized
+    if (input.bench_iterations > 0) {
+        DFnetlist DF(input.graph_name + "_optimized.dot", input.graph_name + "_bbgraph_buf.dot");
+        if (DF.hasError()) {
+            cerr << DF.getError() << endl;
+            return 1;
+        }
+        return DF.benchmarkPathSearch(1, input.bench_iterations) ? 0 : 1;
+    }
+
+    // All the cases in one run, sharing the extraction of the MGs and paths
+    if (not input.batch_cases.empty()) {
+        if (find(input.batch_cases.begin(), input.batch_cases.end(), 0) != input.batch_cases.end()) {
+            user_input best_case = input;
+            best_case.case_selection = 0;
+            generate_best_case_II_log(best_case);
+        }
+
+        DFnetlist DF(input.graph_name + "_optimized.dot", input.graph_name + "_bbgraph_buf.dot");
+        if (DF.hasError()) {
+            cerr << DF.getError() << endl;
+            return 1;
+        }
+        return DF.batchLSQSizing(1, input.graph_name, input.batch_cases) ? 0 : 1;
+    }
+
     //Generate best case II log file if the best case has been selected by the used
     generate_best_case_II_log(input);
 
@@ -182,6 +238,8 @@ int main(int argc, char *argv[]) {
 
     if (argc != 3) {
         cout << "Please provide the following args:\n\t-filepath=<path_to_dot_file>\n\t-case=selected_case (0 for best case scenario / 1 for worst case scenario)" << endl;
+        cout << "\t  (all, or a list like 0,1,2, computes several cases in one run)" << endl;
+        cout << "or, to benchmark the path searches:\n\t-filepath=<path_to_dot_file>\n\t-bench=iterations" << endl;
         return 0;
     }
 
@@ -8,9 +8,11 @@
 #ifndef BUFFERSUTIL_H_
 #define BUFFERSUTIL_H_
 
+#include <iostream>
 #include <map>
+#include <streambuf>
 
-#include "DFnetlist/Dataflow.h"
+#include "Dataflow.h"
 //#include "Dataflow.h"
 
 
@@ -18,8 +20,46 @@ using namespace std;
 using namespace Dataflow;
 
 const int DEFAULT_MILP_TIMEOUT = 100;
+const double DEFAULT_PERIOD = 5;
+const string DEFAULT_MILP_SOLVER = "gurobi_cl";
 
-vector<string> getThroughputFromFile(std::string filename, bool verbose, int timeout=100);
+// Stream buffer that discards everything (used to silence the buffers log)
+class NullBuffer : public std::streambuf {
+protected:
+	int overflow(int c) override { return c; }
+};
+
+/**
+ * Discards everything written to cout while it is alive (if silence is set).
+ * It does nothing if cout is already silenced, so that the threads that evaluate
+ * candidates in parallel never change the stream buffer of cout: the batch is
+ * silenced once by the main thread.
+ */
+class CoutSilencer {
+public:
+	CoutSilencer(bool silence = true) {
+		if (silence && dynamic_cast<NullBuffer *>(cout.rdbuf()) == nullptr)
+			saved = cout.rdbuf(&null_buffer);
+	}
+	~CoutSilencer() {
+		if (saved != nullptr) cout.rdbuf(saved);
+	}
+private:
+	NullBuffer null_buffer;
+	streambuf *saved = nullptr;
+};
+
+/**
+ * Runs the buffer placement with throughput maximization on a netlist in memory,
+ * with the settings of "buffers buffers -period=5". The buffers are annotated in
+ * the channels of the netlist (not instantiated).
+ * Returns one line per marked graph with the throughput achieved, in the format of
+ * the buffers tool ("*** Throughput achieved in sub MG <i>: <th> ***"), or an empty
+ * vector if no buffer placement was found.
+ * The log of the buffer placement is only printed if verbose is set.
+ * It can be called concurrently on different netlists.
+ */
+vector<string> getThroughputFromNetlist(DFnetlist &df, bool verbose, int timeout=DEFAULT_MILP_TIMEOUT);
 
 
 #endif /* BUFFERSUTIL_H_ */
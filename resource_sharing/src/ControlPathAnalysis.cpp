@@ -13,8 +13,17 @@
 #include "ControlPathAnalysis.h"
 #include "resource_sharing.h"
 
-int my_buffer_cnt = 0;
-int my_fork_cnt = 0;
+// Returns the first name prefix + N that is not used in the netlist.
+// The candidate netlists are built concurrently from copies of the same
+// netlist, so the names must only depend on the netlist to be deterministic.
+string getFreshBlockName(DFnetlist &df, const string &prefix) {
+	for (int cnt = 0;; cnt++) {
+		string name = prefix + to_string(cnt);
+		if (df.DFI->getBlock(name) == invalidDataflowID) {
+			return name;
+		}
+	}
+}
 
 bool isControlBlock(DFnetlist &df, blockID id) {
 	//a control path fork has all  output ports of width 0
@@ -74,7 +83,7 @@ blockID addForkAfterPhi(DFnetlist &df, set<blockID> blocks_in_bb) {
 	portID dstPort = df.DFI->getDstPort(channel_to_remove);
 
 	MyBlock newFork = MyBlock::createFork(df, bbId,
-			"additional_fork_cp" + to_string(my_fork_cnt++), 0);
+			getFreshBlockName(df, "additional_fork_cp"), 0);
 
 	MyChannel phi_to_fork(df, channel_to_remove);
 	phi_to_fork.dstPort = newFork.inPorts[0].portId;
@@ -156,9 +165,9 @@ void addStageToControlPath(DFnetlist &df, vector<blockID> &control_path) {
 
 	//create the two new blocks
 	MyBlock newBuffer = MyBlock::createBufferForCP(df, bbId,
-			"additional_buffer_cp_" + to_string(my_buffer_cnt++));
+			getFreshBlockName(df, "additional_buffer_cp_"));
 	MyBlock newFork = MyBlock::createFork(df, bbId,
-			"additional_fork_cp" + to_string(my_fork_cnt++), 0);
+			getFreshBlockName(df, "additional_fork_cp"), 0);
 	
 	if(df.DFI->getBlockType(blockBeforeBranch) == FORK){
 		//link the newly created blocks together
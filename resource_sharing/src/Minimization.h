@@ -8,7 +8,7 @@
 #ifndef MINIMIZATION_H_
 #define MINIMIZATION_H_
 
-#include "DFnetlist/Dataflow.h"
+#include "Dataflow.h"
 #include "resource_sharing.h"
 #include <vector>
 
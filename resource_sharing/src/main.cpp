@@ -27,7 +27,9 @@ using vecParams = vector<string>;
 int main_help()
 {
 	cerr << "Available commands:" << endl;
-	cerr << "  min filename [timeout duration for MILP]: Execute the minimization of the component graph." << endl;
+	cerr << "  min filename [timeout duration for MILP] [threads] [max orderings]: Execute the minimization of the component graph." << endl;
+	cerr << "      threads: number of candidate sharings evaluated in parallel (default 1)." << endl;
+	cerr << "      max orderings: max number of orderings of the shared units tried per pair of groups (default 0, all)." << endl;
 	cerr << "  help:     Print tool help." << endl;
 
 	return 0;
@@ -51,6 +53,8 @@ int min(vecParams& params)
 	cout<<filename<<endl;
 
 	int timeout = params.size() > 1 ? stoi(params[1]) : DEFAULT_MILP_TIMEOUT;
+	int threads = params.size() > 2 ? stoi(params[2]) : 1;
+	int max_orderings = params.size() > 3 ? stoi(params[3]) : 0;
 
 	DFnetlist DF("./_input/"+filename+"_graph.dot");
 	try {
@@ -67,7 +71,7 @@ int min(vecParams& params)
 		}
 		vector<DisjointSet> sets = extractSets(DF, bbGraph);
 
-		 resource_sharing2(DF, sets, nodes, filename, timeout);
+		 resource_sharing2(DF, sets, nodes, filename, timeout, threads, max_orderings);
 
 		//example for gsum
 		//try_suggestion(DF, {{"fadd_11", "fadd_14"}, 
@@ -5,10 +5,15 @@
 #include "resource_sharing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <sstream>
+#include <thread>
 
 #include "BuffersUtil.h"
 #include "ControlPathAnalysis.h"
@@ -144,10 +149,67 @@ bool inSet(set<int> group, int item) {
 	return group.find(item) != group.end();
 }
 
+// Input netlist of each file. It is read only once, and every candidate
+// merge group assignment is evaluated on a copy.
+DFnetlist &getInputNetlist(string filename) {
+	static map<string, unique_ptr<DFnetlist>> netlists { };
+	static mutex netlists_mutex;
+	lock_guard<mutex> lock(netlists_mutex);
+	unique_ptr<DFnetlist> &df = netlists[filename];
+	if (!df) {
+		df.reset(new DFnetlist("./_input/" + filename + "_graph.dot",
+				"./_input/" + filename + "_bbgraph.dot"));
+	}
+	return *df;
+}
+
+// Canonical representation of a merge group assignment. The order of the
+// groups is irrelevant, but not the order of the blocks in each BB (the
+// order in which they use the shared unit).
+string canonicalKey(vector<MergeGroup> &merge_groups, string filename, int timeout) {
+	vector<string> groups { };
+	for (auto &merge_group : merge_groups) {
+		stringstream ss;
+		for (auto &mapping : merge_group.blocks) {
+			ss << mapping.first << ":";
+			for (auto blockId : mapping.second) {
+				ss << blockId << ",";
+			}
+			ss << ";";
+		}
+		groups.push_back(ss.str());
+	}
+	sort(groups.begin(), groups.end());
+
+	stringstream key;
+	key << filename << "/" << timeout << "/";
+	for (auto &group : groups) {
+		key << group << "|";
+	}
+	return key.str();
+}
+
+// Throughputs of the merge group assignments evaluated so far
+map<string, vector<string>> throughput_cache { };
+int throughput_cache_hits = 0;
+int throughput_evaluations = 0;
+mutex throughput_cache_mutex;
+
 vector<string> getThroughputs(vector<MergeGroup> merge_groups, string filename,
-		bool verbose, int timeout) {
-	DFnetlist tmp("./_input/" + filename + "_graph.dot",
-			"./_input/" + filename + "_bbgraph.dot");
+		bool verbose, int timeout, string buffered_file = "") {
+	// The netlist with buffers is only available when evaluated
+	string key = canonicalKey(merge_groups, filename, timeout);
+	if (buffered_file.empty() && !verbose) {
+		lock_guard<mutex> lock(throughput_cache_mutex);
+		auto it = throughput_cache.find(key);
+		if (it != throughput_cache.end()) {
+			cout << "throughput already evaluated for this assignment" << endl;
+			++throughput_cache_hits;
+			return it->second;
+		}
+	}
+
+	DFnetlist tmp(getInputNetlist(filename));
 	map<bbID, set<blockID>> nodesPerBB = getNodesPerBBs(tmp);
 	map<bbID, vector<blockID>> controlPathsPerBB { };
 
@@ -191,14 +253,24 @@ vector<string> getThroughputs(vector<MergeGroup> merge_groups, string filename,
 		}
 	}
 
-	tmp.writeDot("./_tmp/out.dot");
-	return getThroughputFromFile("./_tmp/out", verbose, timeout);
+	vector<string> throughputs = getThroughputFromNetlist(tmp, verbose, timeout);
+	{
+		lock_guard<mutex> lock(throughput_cache_mutex);
+		++throughput_evaluations;
+		throughput_cache[key] = throughputs;
+	}
+
+	if (!buffered_file.empty()) {
+		tmp.instantiateElasticBuffers();
+		tmp.writeDot(buffered_file);
+	}
+	return throughputs;
 }
 
 bool checkThroughput(vector<MergeGroup> merge_groups, vector<string> &expected,
-		string filename, bool verbose, int timeout) {
+		string filename, bool verbose, int timeout, string buffered_file = "") {
 	cout << "checking throughput" << endl;
-	vector<string> results = getThroughputs(merge_groups, filename, verbose, timeout);
+	vector<string> results = getThroughputs(merge_groups, filename, verbose, timeout, buffered_file);
 	if (verbose) {
 		for (auto result : results)
 			cout << result << endl;
@@ -228,31 +300,68 @@ MergeGroup combine_groups(MergeGroup mg_1, MergeGroup mg_2) {
 	return new_merge_group;
 }
 
+// Tries to combine two merge groups without reducing the throughput. The
+// candidates (pairs of groups and orderings of their blocks) are evaluated by
+// a pool of threads, each one on its own copy of the input netlist.
+// The first candidate in the sequential order that keeps the throughput is
+// accepted, so that the result does not depend on the number of threads.
 bool try_combine_groups(DFnetlist &df, vector<MergeGroup> &merge_groups,
-		vector<string> &initial_throughputs, string filename, int timeout) {
+		vector<string> &initial_throughputs, string filename, int timeout,
+		int threads, int max_orderings) {
+	vector<vector<MergeGroup>> candidates { };
 	for (auto it_1 = merge_groups.begin(); it_1 != merge_groups.end(); ++it_1) {
 		for (auto it_2 = it_1 + 1; it_2 != merge_groups.end(); ++it_2) {
-			vector<MergeGroup> possible_merge_groups {combine_groups(*it_1, *it_2).get_all_orderings()};
+			vector<MergeGroup> possible_merge_groups {combine_groups(*it_1, *it_2).get_all_orderings(max_orderings)};
 			for(auto mg : possible_merge_groups){
-				cout << "attempting to combine new group : " << endl;
-				mg.print(df);
 				vector<MergeGroup> copy = {mg};
 				copy.insert(copy.end(), merge_groups.begin(), it_1);
 				copy.insert(copy.end(), it_1 + 1, it_2);
 				copy.insert(copy.end(), it_2 + 1, merge_groups.end());
-				if (checkThroughput(copy, initial_throughputs, filename, false, timeout)) {
-					merge_groups = copy;
-					return true;
-				}
+				candidates.push_back(copy);
 			}
 		}
 	}
-	return false;
+
+	// The candidates after the best accepted one are not evaluated
+	int num_candidates = candidates.size();
+	atomic<int> next_candidate(0);
+	atomic<int> accepted(num_candidates);
+
+	auto worker = [&]() {
+		for (int i = next_candidate++; i < accepted; i = next_candidate++) {
+			cout << "attempting to combine new group : " << endl;
+			candidates[i][0].print(df);
+			if (checkThroughput(candidates[i], initial_throughputs, filename, false, timeout)) {
+				int best = accepted;
+				while (i < best && !accepted.compare_exchange_weak(best, i))
+					;
+			}
+		}
+	};
+
+	int num_threads = min(threads, num_candidates);
+	if (num_threads <= 1) worker();
+	else {
+		cout << "evaluating " << num_candidates << " candidates with " << num_threads << " threads" << endl;
+		CoutSilencer silencer;
+		vector<thread> pool;
+		for (int t = 0; t < num_threads; ++t) pool.emplace_back(worker);
+		for (thread &t : pool) t.join();
+	}
+
+	if (accepted == num_candidates) return false;
+	if (num_threads > 1) {
+		cout << "combined new group : " << endl;
+		candidates[accepted][0].print(df);
+	}
+	merge_groups = candidates[accepted];
+	return true;
 }
 
 vector<MergeGroup> intra_set_sharing(DFnetlist &df, DisjointSet disjoint_set,
 		map<int, MyBlock> &nodes, vector<string> &initial_throughputs,
-		string merged_operation, string filename, int timeout) {
+		string merged_operation, string filename, int timeout, int threads,
+		int max_orderings) {
 	vector<MergeGroup> merge_groups { };
 
 	set<blockID> flattened_set = { };
@@ -272,13 +381,15 @@ vector<MergeGroup> intra_set_sharing(DFnetlist &df, DisjointSet disjoint_set,
 		}
 
 	}
-	while (try_combine_groups(df, merge_groups, initial_throughputs, filename, timeout))
+	while (try_combine_groups(df, merge_groups, initial_throughputs, filename, timeout,
+			threads, max_orderings))
 		;
 	return merge_groups;
 }
 
 void resource_sharing2(DFnetlist &df, vector<DisjointSet> disjoint_sets,
-		map<int, MyBlock> &nodes, string filename, int timeout) {
+		map<int, MyBlock> &nodes, string filename, int timeout, int threads,
+		int max_orderings) {
 	vector<string> initial_throughputs = getThroughputs(vector<MergeGroup> { },
 			filename, false, timeout);
 
@@ -290,7 +401,7 @@ void resource_sharing2(DFnetlist &df, vector<DisjointSet> disjoint_sets,
 		for (auto set : disjoint_sets) {
 			merge_group_for_op.push_back(
 					intra_set_sharing(df, set, nodes, initial_throughputs,
-							merge_op, filename, timeout));
+							merge_op, filename, timeout, threads, max_orderings));
 		}
 		merge_groups_per_set[merge_op] = merge_group_for_op;
 	}
@@ -322,9 +433,11 @@ void resource_sharing2(DFnetlist &df, vector<DisjointSet> disjoint_sets,
 	cout << "checking final throughputs == initial throughputs" << endl;
 
 	//empirically observed that a bigger timeout is necessary for the final check
-	if(!checkThroughput(flattened_merge_groups, initial_throughputs, filename, false, 3*timeout)){
+	if(!checkThroughput(flattened_merge_groups, initial_throughputs, filename, false, 3*timeout, "./_tmp/out_graph_buf.dot")){
 		cout << "final throughputs not equal to initial throughput, try with longer MILP timeout" << endl;
 	}
+	cout << "throughput evaluations : " << throughput_evaluations << " (" << throughput_cache_hits
+			<< " assignments found in the cache)" << endl;
 			
 	
 	DFnetlist newDf("./_tmp/out_graph_buf.dot",
@@ -401,7 +514,7 @@ void try_suggestion(DFnetlist &df, vector<vector<string>> suggestion,
 
 	cout << "checking final throughputs == initial throughputs" << endl;
 	//assert(
-	checkThroughput(merge_groups, initial_throughputs, filename, false, 200);//);
+	checkThroughput(merge_groups, initial_throughputs, filename, false, 200, "./_tmp/out_graph_buf.dot");//);
 
 	DFnetlist newDf("./_tmp/out_graph_buf.dot",
 			"./_input/" + filename + "_bbgraph.dot");
@@ -56,13 +56,15 @@ struct MergeGroup {
 		ord.push_back(blockId);
 	}
 
-	vector<MergeGroup> get_all_orderings(){
+	// All the orderings of the blocks in each BB. If max_orderings > 0, only the
+	// first max_orderings of them are generated (in the same order).
+	vector<MergeGroup> get_all_orderings(int max_orderings = 0){
 		map<bbID, vector<ordering>> all_orderings_per_bbID = {};
 		for(auto mapping : blocks){
-			all_orderings_per_bbID[mapping.first] = get_ordering_permutations(mapping.second);
+			all_orderings_per_bbID[mapping.first] = get_ordering_permutations(mapping.second, max_orderings);
 		}
 
-		vector<map<bbID, ordering>> all_orderings = get_cartesian_product(all_orderings_per_bbID);
+		vector<map<bbID, ordering>> all_orderings = get_cartesian_product(all_orderings_per_bbID, max_orderings);
 
 		vector<MergeGroup> all_merge_groups = {};
 		for(auto possible_ordering : all_orderings){
@@ -75,7 +77,11 @@ struct MergeGroup {
 
 	private:
 
-		vector<map<bbID, ordering>> get_cartesian_product(map<bbID, vector<ordering>> possible_orderings_per_bbID){
+		static bool limit_reached(size_t size, int limit){
+			return limit > 0 && size >= limit;
+		}
+
+		vector<map<bbID, ordering>> get_cartesian_product(map<bbID, vector<ordering>> possible_orderings_per_bbID, int limit){
 			vector<map<bbID, ordering>> results {};
 			//base case
 			if(possible_orderings_per_bbID.size() == 1){
@@ -83,6 +89,7 @@ struct MergeGroup {
 				bbID id = bb_ordering_pair.first;
 				vector<ordering> & orderings = bb_ordering_pair.second;
 				for(auto ord : orderings){
+					if(limit_reached(results.size(), limit)) break;
 					map<bbID, ordering> new_map{};
 					new_map[id] = ord;
 					results.push_back(new_map);
@@ -92,9 +99,10 @@ struct MergeGroup {
 				map<bbID, vector<ordering>> copy(possible_orderings_per_bbID);
 				pair<bbID, vector<ordering>> head = *(copy.begin());
 				copy.erase(head.first);
-				vector<map<bbID, ordering>> inner_results = get_cartesian_product(copy);
+				vector<map<bbID, ordering>> inner_results = get_cartesian_product(copy, limit);
 				for(ordering ord : head.second){
 					for(map<bbID, ordering> inner_result : inner_results){
+						if(limit_reached(results.size(), limit)) return results;
 						map<bbID, ordering> new_map{inner_result};
 						new_map[head.first] = ord;
 						results.push_back(new_map);
@@ -104,7 +112,7 @@ struct MergeGroup {
 			return results;
 		}
 
-		vector<ordering> get_ordering_permutations(ordering & initial_ordering){
+		vector<ordering> get_ordering_permutations(ordering & initial_ordering, int limit){
 			//base case
 			if(initial_ordering.size() == 1){
 				return {initial_ordering};
@@ -114,8 +122,9 @@ struct MergeGroup {
 				for(int i = 0; i < initial_ordering.size(); ++i){
 					ordering copy = initial_ordering;
 					copy.erase(copy.begin() + i);
-					vector<ordering> inner_permutations = get_ordering_permutations(copy);
+					vector<ordering> inner_permutations = get_ordering_permutations(copy, limit);
 					for(auto inner_permutation : inner_permutations){
+						if(limit_reached(permutations.size(), limit)) return permutations;
 						inner_permutation.push_back(initial_ordering.begin()[i]);
 						permutations.push_back(inner_permutation);
 					}
@@ -144,7 +153,8 @@ bool mergeAffectsThtoughput(DFnetlist &df, int node1_id, int node2_id,
 
 
 void resource_sharing2(DFnetlist &df, vector<DisjointSet> disjoint_sets,
-		map<int, MyBlock> &nodes, string filename, int timeout);
+		map<int, MyBlock> &nodes, string filename, int timeout,
+		int threads = 1, int max_orderings = 0);
 
 map<int, set<int>> getNodesPerBBs(DFnetlist &df);
 